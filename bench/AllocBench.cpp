@@ -0,0 +1,127 @@
+#include "Bench.hpp"
+#include "../include/ListGraph.hpp"
+
+#include <new>
+#include <atomic>
+#include <cstdlib>
+
+// every allocation of the benchmark binary goes through these, so a build can be measured in calls to the heap
+static std::atomic<size_t> allocations = 0;
+static std::atomic<size_t> allocatedBytes = 0;
+
+void *operator new(size_t size) {
+    allocations++;
+    allocatedBytes += size;
+    if (void *p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new(size_t size, std::align_val_t alignment) {
+    allocations++;
+    allocatedBytes += size;
+    size_t align = size_t(alignment);
+    if (void *p = std::aligned_alloc(align, (std::max<size_t>(size, 1) + align - 1) / align * align)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+/**
+ * @brief Build and destroy a graph, report the best time and the heap traffic of one build
+ */
+template<typename F>
+static void measure(const std::string &name, F build, int repeat) {
+    std::stringstream ss;
+    ss << name;
+    for (Type::Storage storage : {Type::Storage::HEAP, Type::Storage::ARENA}) {
+        size_t calls = allocations;
+        size_t bytes = allocatedBytes;
+        build(storage);
+        calls = allocations - calls;
+        bytes = allocatedBytes - bytes;
+
+        double ms = Bench::bestOf([&] { build(storage); }, repeat);
+        ss << (storage == Type::Storage::HEAP ? " | heap : " : " | arena : ") << ms << " ms, "
+           << calls << " allocations, " << bytes / (1 << 20) << " MiB";
+    }
+    Logger::info(ss.str());
+}
+
+/**
+ * @brief Run the same path queries with fresh memory and with one workspace, report the best time and the heap traffic per query
+ */
+static void queries(int n, int count, int repeat) {
+    auto g = List::Graph<int>::createRandomGraph(n, Type::Graph::UNDIRECTED, 8.0 / n, true);
+    std::vector<std::pair<int, int>> pairs;
+    for (int i = 0; i < count; i++) {
+        pairs.emplace_back(int((i * 7919ll) % n), int((i * 104729ll + 17) % n));
+    }
+
+    long total = 0;
+    auto fresh = [&] {
+        for (auto [from, to] : pairs) {
+            auto res = g.path(from, to);
+            total += res.has_value() ? res.value().first : 0;
+        }
+    };
+    TraversalWorkspace<int> workspace;
+    auto borrowed = [&] {
+        for (auto [from, to] : pairs) {
+            auto res = g.path(from, to, workspace);
+            total += res.has_value() ? res.value().first : 0;
+        }
+    };
+
+    std::stringstream ss;
+    ss << "path queries";
+    for (bool reuse : {false, true}) {
+        size_t calls = allocations;
+        size_t bytes = allocatedBytes;
+        reuse ? borrowed() : fresh();
+        calls = allocations - calls;
+        bytes = allocatedBytes - bytes;
+
+        double ms = Bench::bestOf([&] { reuse ? borrowed() : fresh(); }, repeat);
+        ss << (reuse ? " | workspace : " : " | fresh : ") << ms * 1000 / count << " us/query, "
+           << double(calls) / count << " allocations, " << bytes / count << " bytes per query";
+    }
+    Logger::info(ss.str() + " (checksum " + std::to_string(total) + ")");
+}
+
+void Bench::alloc(const Bench::Args &args) {
+    int n = int(option(args, "-n", 3000));
+    double p = option(args, "-p", 0.5);
+    int repeat = int(option(args, "--repeat", 3));
+
+    Logger::info("List::Graph build benchmark, n = " + std::to_string(n) + ", p = " + std::to_string(p) + ", best of " + std::to_string(repeat));
+
+    measure("createCompleteGraph", [&](Type::Storage storage) {
+        auto g = List::Graph<int>::createCompleteGraph(n, Type::Graph::UNDIRECTED, false, storage);
+    }, repeat);
+    measure("createRandomGraph", [&](Type::Storage storage) {
+        auto g = List::Graph<int>::createRandomGraph(n, Type::Graph::UNDIRECTED, p, false, storage);
+    }, repeat);
+    measure("createCycleGraph", [&](Type::Storage storage) {
+        auto g = List::Graph<int>::createCycleGraph(n * 100, Type::Graph::UNDIRECTED, false, storage);
+    }, repeat);
+
+    queries(n * 10, int(option(args, "-q", 1000)), repeat);
+}
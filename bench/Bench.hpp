@@ -0,0 +1,69 @@
+#pragma once
+
+#include "../include/Logger.hpp"
+#include "../include/Utils.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <sstream>
+#include <algorithm>
+
+namespace Bench {
+    using Args = std::map<std::string, std::vector<std::string>>;
+
+    /**
+     * @brief Read a numeric option
+     * @param args -> the parsed command line
+     * @param name -> the option, e.g. "-n"
+     * @param value -> the default value
+     * @return the value of the option, or the default
+     */
+    inline double option(const Args &args, const std::string &name, double value) {
+        if (args.contains(name)) {
+            const std::vector<std::string> &values = args.at(name);
+            if (values.size() != 1 || !Utils::isDouble(values[0])) {
+                Logger::error("Argument for " + name + " is not a number");
+                exit(1);
+            }
+            value = std::stod(values[0]);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Best wall time of a function over several runs
+     * @param f -> the function to time
+     * @param repeat -> number of runs
+     * @return the fastest run, in milliseconds
+     */
+    template<typename F>
+    double bestOf(F f, int repeat) {
+        double best = 0;
+        for (int i = 0; i < repeat; i++) {
+            auto start = std::chrono::high_resolution_clock::now();
+            f();
+            auto end = std::chrono::high_resolution_clock::now();
+            double ms = std::chrono::duration<double, std::milli>(end - start).count();
+            best = i == 0 ? ms : std::min(best, ms);
+        }
+        return best;
+    }
+
+    void sssp(const Args &args);
+
+    void diameter(const Args &args);
+
+    void edges(const Args &args);
+
+    void traversal(const Args &args);
+
+    void gemm(const Args &args);
+
+    void strassen(const Args &args);
+
+    void alloc(const Args &args);
+
+    void compressed(const Args &args);
+}
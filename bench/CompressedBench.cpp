@@ -0,0 +1,72 @@
+#include "Bench.hpp"
+#include "../include/CsrGraph.hpp"
+#include "../include/CompressedGraph.hpp"
+
+#include <random>
+
+void Bench::compressed(const Bench::Args &args) {
+    auto n = uint32_t(option(args, "-n", 1000000));
+    int degree = int(option(args, "--degree", 8));
+    auto window = uint32_t(option(args, "--window", 1024));
+    int repeat = int(option(args, "--repeat", 3));
+
+    Logger::info("Compressed adjacency benchmark on " + std::to_string(n) + " vertices of out-degree " + std::to_string(degree) + ", best of " + std::to_string(repeat));
+
+    std::mt19937 gen(42);
+    for (bool local : {false, true}) {
+        // random targets, or targets within a window around the vertex like a graph numbered by locality
+        List::Graph<uint32_t> list(n, Type::Graph::DIRECTED);
+        std::uniform_int_distribution<uint32_t> anywhere(0, n - 1);
+        std::uniform_int_distribution<uint32_t> near(0, 2 * window);
+        for (uint32_t v = 0; v < n; v++) {
+            for (int i = 0; i < degree; i++) {
+                list.addEdge(v, local ? std::min<uint32_t>(n - 1, uint32_t(std::max<int64_t>(0, int64_t(v) + near(gen) - window))) : anywhere(gen));
+            }
+        }
+
+        Csr::Graph<uint32_t> csr(list);
+        Compressed::Graph<uint32_t> compressed(list);
+        double arcs = double(csr.arcs());
+
+        // one pass over every list, the sum keeps the loads alive
+        uint64_t expected = 0;
+        double csrScan = bestOf([&] {
+            uint64_t sum = 0;
+            for (uint32_t v = 0; v < n; v++) {
+                for (uint32_t z : csr.neighbours(v)) {
+                    sum += z;
+                }
+            }
+            expected = sum;
+        }, repeat);
+        double compressedScan = bestOf([&] {
+            uint64_t sum = 0;
+            for (uint32_t v = 0; v < n; v++) {
+                compressed.forEachNeighbour(v, [&sum](uint32_t z) {
+                    sum += z;
+                });
+            }
+            if (sum != expected) {
+                Logger::error("Decoded lists differ");
+                exit(1);
+            }
+        }, repeat);
+
+        TraversalWorkspace<uint32_t, int32_t> workspace(n);
+        size_t reached = 0;
+        double csrBFS = bestOf([&] { reached = csr.BFS(0).size(); }, repeat);
+        double compressedBFS = bestOf([&] {
+            if (compressed.BFS(0, workspace).size() != reached) {
+                Logger::error("BFS orders differ");
+                exit(1);
+            }
+        }, repeat);
+
+        std::stringstream ss;
+        ss << (local ? "window " + std::to_string(window) : std::string("random")) << " targets"
+           << " || bytes per arc csr : " << 4 << " (+ 4 of weight) | compressed : " << double(compressed.encodedBytes()) / arcs
+           << " || scan csr : " << arcs / csrScan / 1000 << " M arcs/s | compressed : " << arcs / compressedScan / 1000 << " M arcs/s"
+           << " || BFS csr : " << csrBFS << " ms | compressed : " << compressedBFS << " ms";
+        Logger::info(ss.str());
+    }
+}
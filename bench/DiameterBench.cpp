@@ -0,0 +1,33 @@
+#include "Bench.hpp"
+#include "../include/ListGraph.hpp"
+
+void Bench::diameter(const Bench::Args &args) {
+    int n = int(option(args, "-n", 2000));
+    double p = option(args, "-p", .005);
+    int repeat = int(option(args, "--repeat", 1));
+
+    Logger::info("Diameter benchmark on createRandomGraph(" + std::to_string(n) + ", " + std::to_string(p) + ")");
+
+    auto g = List::Graph<int>::createRandomGraph(n, Type::UNDIRECTED, p);
+
+    std::optional<std::pair<int, std::pair<int, int>>> expected, res;
+    double everyVertex = bestOf([&] {
+        expected.reset();
+        for (int i = 0; i < g.size(); i++) {
+            auto ecc = g.eccentricity(i);
+            if (ecc.has_value() && (!expected.has_value() || expected.value().first < ecc.value().first)) {
+                expected = {ecc.value().first, {i, ecc.value().second}};
+            }
+        }
+    }, repeat);
+    double bounding = bestOf([&] { res = g.diameter(); }, repeat);
+
+    if (res != expected) {
+        Logger::error("Bounding diameters differs from the eccentricity of every vertex");
+        exit(1);
+    }
+
+    std::stringstream ss;
+    ss << "Diameter " << res.value_or(std::pair(0, std::pair(0, 0))).first << " | every eccentricity : " << everyVertex << " ms | bounding diameters : " << bounding << " ms | speedup x" << everyVertex / bounding;
+    Logger::info(ss.str());
+}
@@ -0,0 +1,39 @@
+#include "Bench.hpp"
+#include "../include/ListGraph.hpp"
+
+#include <random>
+
+void Bench::edges(const Bench::Args &args) {
+    int n = int(option(args, "-n", 50000));
+
+    Logger::info("Edge benchmark on createStarGraph(" + std::to_string(n) + "), probe then remove every edge of the centre");
+
+    std::vector<int> order(n - 1);
+    for (int i = 0; i < n - 1; i++) {
+        order[i] = i + 1;
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+    std::stringstream ss;
+    for (bool indexed : {false, true}) {
+        auto g = List::Graph<int>::createStarGraph(n);
+        if (indexed) {
+            g.indexEdges();
+        }
+
+        size_t found = 0;
+        double ms = bestOf([&] {
+            for (int v : order) {
+                found += g.isEdge(0, v);
+                g.removeEdge(0, v);
+            }
+        }, 1);
+
+        if (found != order.size() || g.degres(0) != 0) {
+            Logger::error("Edges are missing");
+            exit(1);
+        }
+        ss << (indexed ? " | edge index : " : "scan : ") << ms << " ms";
+    }
+    Logger::info(ss.str());
+}
@@ -0,0 +1,59 @@
+#include "Bench.hpp"
+#include "../include/Matrix.hpp"
+
+#include <random>
+
+template<typename T>
+static void gemmFor(const std::string &type, size_t maxSize, size_t naiveSize, int repeat, ThreadPool &pool) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 3);
+
+    for (size_t n = 256; n <= maxSize; n *= 2) {
+        std::vector<T> a(n * n), b(n * n), c(n * n), expected(n * n);
+        for (size_t i = 0; i < n * n; i++) {
+            a[i] = T(dist(gen));
+            b[i] = T(dist(gen));
+        }
+
+        double flop = 2.0 * double(n) * double(n) * double(n);
+        std::stringstream ss;
+        ss << type << " " << n << "x" << n;
+
+        double blocked = Bench::bestOf([&] { Gemm::multiply(a.data(), b.data(), c.data(), n, n, n); }, repeat);
+        ss << " | blocked : " << flop / blocked / 1e6 << " GFLOP/s";
+
+        if (pool.size() > 1) {
+            std::vector<T> parallel(n * n);
+            double ms = Bench::bestOf([&] { Gemm::multiply(a.data(), b.data(), parallel.data(), n, n, n, &pool); }, repeat);
+            if (parallel != c) {
+                Logger::error("Parallel and sequential products differ");
+                exit(1);
+            }
+            ss << " | " << pool.size() << " threads : " << flop / ms / 1e6 << " GFLOP/s";
+        }
+
+        if (n <= naiveSize) {
+            double naive = Bench::bestOf([&] { Gemm::naive(a.data(), b.data(), expected.data(), n, n, n); }, 1);
+            if (expected != c) {
+                Logger::error("Blocked and naive products differ");
+                exit(1);
+            }
+            ss << " | naive : " << flop / naive / 1e6 << " GFLOP/s";
+        }
+        Logger::info(ss.str());
+    }
+}
+
+void Bench::gemm(const Bench::Args &args) {
+    auto maxSize = size_t(option(args, "-n", 1024));
+    auto naiveSize = size_t(option(args, "--naive", 1024));
+    int repeat = int(option(args, "--repeat", 1));
+    ThreadPool pool(size_t(option(args, "--threads", 0)));
+
+    Logger::info("GEMM benchmark on n x n matrices from 256 to " + std::to_string(maxSize) + ", naive i-j-k up to " + std::to_string(naiveSize)
+                 + ", " + std::to_string(pool.size()) + " threads");
+
+    gemmFor<int>("int", maxSize, naiveSize, repeat, pool);
+    gemmFor<float>("float", maxSize, naiveSize, repeat, pool);
+    gemmFor<double>("double", maxSize, naiveSize, repeat, pool);
+}
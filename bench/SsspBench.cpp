@@ -0,0 +1,28 @@
+#include "Bench.hpp"
+#include "../include/ListGraph.hpp"
+
+#include <thread>
+
+void Bench::sssp(const Bench::Args &args) {
+    int n = int(option(args, "-n", 10000));
+    double p = option(args, "-p", .01);
+    size_t threads = size_t(option(args, "--threads", 0));
+    int repeat = int(option(args, "--repeat", 3));
+
+    Logger::info("SSSP benchmark on createRandomGraph(" + std::to_string(n) + ", " + std::to_string(p) + ", includeRandomWeight=true)");
+
+    auto g = List::Graph<int>::createRandomGraph(n, Type::UNDIRECTED, p, true);
+
+    std::vector<int> expected, res;
+    double dijkstra = bestOf([&] { expected = g.distanceFrom(0); }, repeat);
+    double deltaStepping = bestOf([&] { res = g.deltaSteppingDistanceFrom(0, threads); }, repeat);
+
+    if (res != expected) {
+        Logger::error("Delta-stepping distances differ from Dijkstra");
+        exit(1);
+    }
+
+    std::stringstream ss;
+    ss << "Dijkstra : " << dijkstra << " ms | delta-stepping (" << (threads == 0 ? std::thread::hardware_concurrency() : threads) << " threads) : " << deltaStepping << " ms | speedup x" << dijkstra / deltaStepping;
+    Logger::info(ss.str());
+}
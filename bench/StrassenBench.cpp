@@ -0,0 +1,51 @@
+#include "Bench.hpp"
+#include "../include/Strassen.hpp"
+
+#include <cmath>
+#include <random>
+
+template<typename T>
+static void strassenFor(const std::string &type, size_t maxSize, size_t crossover, int repeat, ThreadPool &pool) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-1, 1);
+
+    Strassen::Arena<T> arena;
+    for (size_t n = 512; n <= maxSize; n *= 2) {
+        std::vector<T> a(n * n), b(n * n), blocked(n * n), strassen(n * n);
+        for (size_t i = 0; i < n * n; i++) {
+            // small integers for the integer types, [-1, 1] for the floating ones
+            a[i] = std::is_integral_v<T> ? T(dist(gen) * 8) : T(dist(gen));
+            b[i] = std::is_integral_v<T> ? T(dist(gen) * 8) : T(dist(gen));
+        }
+
+        double gemm = Bench::bestOf([&] { Gemm::multiply(a.data(), b.data(), blocked.data(), n, n, n, &pool); }, repeat);
+        double ms = Bench::bestOf([&] { arena.multiply(a.data(), b.data(), strassen.data(), n, crossover, &pool); }, repeat);
+
+        double error = 0;
+        double scale = 0;
+        for (size_t i = 0; i < n * n; i++) {
+            error = std::max(error, std::abs(double(strassen[i]) - double(blocked[i])));
+            scale = std::max(scale, std::abs(double(blocked[i])));
+        }
+
+        std::stringstream ss;
+        ss << type << " " << n << "x" << n << " | blocked : " << gemm << " ms | strassen : " << ms << " ms ("
+           << Strassen::levels(n, crossover) << " levels) | speedup : " << gemm / ms
+           << " | max relative error : " << (scale == 0 ? 0 : error / scale);
+        Logger::info(ss.str());
+    }
+}
+
+void Bench::strassen(const Bench::Args &args) {
+    auto maxSize = size_t(option(args, "-n", 2048));
+    auto crossover = size_t(option(args, "--crossover", double(Strassen::defaultCrossover)));
+    int repeat = int(option(args, "--repeat", 1));
+    ThreadPool pool(size_t(option(args, "--threads", 1)));
+
+    Logger::info("Strassen benchmark on n x n matrices from 512 to " + std::to_string(maxSize) + ", crossover "
+                 + std::to_string(crossover) + ", " + std::to_string(pool.size()) + " threads");
+
+    strassenFor<int>("int", maxSize, crossover, repeat, pool);
+    strassenFor<float>("float", maxSize, crossover, repeat, pool);
+    strassenFor<double>("double", maxSize, crossover, repeat, pool);
+}
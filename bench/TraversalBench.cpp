@@ -0,0 +1,34 @@
+#include "Bench.hpp"
+#include "../include/ListGraph.hpp"
+#include "../include/MatrixGraph.hpp"
+
+void Bench::traversal(const Bench::Args &args) {
+    int n = int(option(args, "-n", 3000));
+    int repeat = int(option(args, "--repeat", 3));
+
+    Logger::info("Traversal benchmark on createCompleteGraph(" + std::to_string(n) + "), best of " + std::to_string(repeat));
+
+    auto list = List::Graph<int>::createCompleteGraph(n);
+    auto matrix = Matrix::Graph<int>::createCompleteGraph(n);
+
+    std::vector<int> res;
+    double listBFS = bestOf([&] { res = list.BFS(); }, repeat);
+    double matrixBFS = bestOf([&] {
+        if (matrix.BFS() != res) {
+            Logger::error("BFS orders differ");
+            exit(1);
+        }
+    }, repeat);
+    double listDFS = bestOf([&] { res = list.DFS(); }, repeat);
+    double matrixDFS = bestOf([&] {
+        if (matrix.DFS() != res) {
+            Logger::error("DFS orders differ");
+            exit(1);
+        }
+    }, repeat);
+
+    std::stringstream ss;
+    ss << "BFS list : " << listBFS << " ms | matrix : " << matrixBFS << " ms"
+       << " || DFS list : " << listDFS << " ms | matrix : " << matrixDFS << " ms";
+    Logger::info(ss.str());
+}
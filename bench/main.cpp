@@ -0,0 +1,54 @@
+#include "Bench.hpp"
+
+int main(int argv, char **argc) {
+
+    // Convert argv to map
+    Bench::Args args;
+
+    for (int i = 0; i < argv; i++) {
+        auto arg = std::string(argc[i]);
+        if (arg[0] == '-') {
+            args[arg] = std::vector<std::string>();
+            for (int j = i + 1; j < argv; j++) {
+                std::string arg2 = argc[j];
+                if (arg2[0] == '-') {
+                    break;
+                } else {
+                    args[arg].push_back(arg2);
+                }
+            }
+        }
+    }
+
+    Logger::setLogLevel(args.contains("--debug") ? LogLevel::DEBUG : LogLevel::INFO);
+
+    if (argv < 2 || args.contains("-h") || args.contains("--help")) {
+        std::cout << "./ggraph-bench [sssp | diameter | edges | traversal | gemm | strassen | alloc | compressed] [-n | -p | -q | --threads | --repeat | --naive | --crossover | --degree | --window]" << std::endl;
+        return argv < 2;
+    }
+
+    std::string benchmark = argc[1];
+
+    if (benchmark == "sssp") {
+        Bench::sssp(args);
+    } else if (benchmark == "diameter") {
+        Bench::diameter(args);
+    } else if (benchmark == "edges") {
+        Bench::edges(args);
+    } else if (benchmark == "traversal") {
+        Bench::traversal(args);
+    } else if (benchmark == "gemm") {
+        Bench::gemm(args);
+    } else if (benchmark == "strassen") {
+        Bench::strassen(args);
+    } else if (benchmark == "alloc") {
+        Bench::alloc(args);
+    } else if (benchmark == "compressed") {
+        Bench::compressed(args);
+    } else {
+        Logger::error("Unknown benchmark : " + benchmark);
+        return 1;
+    }
+
+    return 0;
+}
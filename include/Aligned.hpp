@@ -0,0 +1,44 @@
+#pragma once
+
+#include <new>
+#include <vector>
+#include <cstddef>
+
+namespace Aligned {
+    /**
+     * @brief Alignment of the buffers, a cache line and a 512 bits vector
+     */
+    constexpr size_t alignment = 64;
+
+    /**
+     * @brief Allocator whose blocks start on an alignment boundary, so the rows of the kernels never straddle a cache line at their start
+     */
+    template<typename T>
+    struct Allocator {
+        using value_type = T;
+
+        Allocator() = default;
+
+        template<typename U>
+        Allocator(const Allocator<U> &) {}
+
+        T *allocate(size_t n) {
+            return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(alignment)));
+        }
+
+        void deallocate(T *p, size_t) {
+            ::operator delete(p, std::align_val_t(alignment));
+        }
+
+        template<typename U>
+        bool operator==(const Allocator<U> &) const {
+            return true;
+        }
+    };
+
+    /**
+     * @brief Owning aligned buffer, moving it hands the block over without copying
+     */
+    template<typename T>
+    using Vector = std::vector<T, Allocator<T>>;
+}
@@ -10,10 +10,13 @@
 #include <string>
 #include <map>
 #include <chrono>
+#include <limits>
+#include <cstdint>
+#include <stdexcept>
 
 void checkArgs(std::map<std::string, std::vector<std::string>> args) {
     if (args.contains("-h") || args.contains("--help")) {
-        std::cout << "./ggraph [matrix | list] [-a | --algo, -n | --nodes, -v | --version, --debug, -p | --probability, -t | --templates]" << std::endl;
+        std::cout << "./ggraph [matrix | list] [-a | --algo, -n | --nodes, -v | --version, --debug, -p | --probability, -t | --templates, --threads, --unweighted]" << std::endl;
         exit(0);
     }
 
@@ -29,13 +32,11 @@ void checkArgs(std::map<std::string, std::vector<std::string>> args) {
     }
 }
 
-template<typename G>
-void runGraphArgs(std::map<std::string, std::vector<std::string>> args) {
-    Logger::debug("Running graph args");
-
-    int n = 1000;
-    double p = .01;
-    G g;
+/**
+ * @brief The number of vertices of -n | --nodes, 1000 by default
+ */
+size_t nodesArg(std::map<std::string, std::vector<std::string>> &args) {
+    size_t n = 1000;
 
     if (args.contains("-n") || args.contains("--nodes")) {
         std::vector<std::string> nArgs = args.contains("-n") ? args["-n"] : args["--nodes"];
@@ -44,13 +45,49 @@ void runGraphArgs(std::map<std::string, std::vector<std::string>> args) {
             exit(1);
         }
         if (Utils::isDouble(nArgs[0])) {
-            n = std::stoi(nArgs[0]);
+            n = std::stoull(nArgs[0]);
         } else {
             Logger::error("Argument for -n | --nodes is not a number");
             exit(1);
         }
     }
 
+    return n;
+}
+
+/**
+ * @brief The vertex of an argument, the program exits if it is not a vertex of a graph of that size
+ * @param error -> the message if the argument is not a number
+ * @tparam T the vertex ids of the graph
+ */
+template<typename T>
+T vertexArg(const std::string &arg, size_t size, const std::string &error) {
+    if (!Utils::isNumber(arg)) {
+        Logger::error(error);
+        exit(1);
+    }
+
+    unsigned long long vertex = std::numeric_limits<unsigned long long>::max();
+    try {
+        vertex = std::stoull(arg);
+    } catch (const std::out_of_range &) {
+    }
+    if (vertex >= size) {
+        Logger::error("Vertex " + arg + " is not in the graph of " + std::to_string(size) + " vertices");
+        exit(1);
+    }
+    return T(vertex);
+}
+
+template<typename G>
+void runGraphArgs(std::map<std::string, std::vector<std::string>> args) {
+    Logger::debug("Running graph args");
+
+    size_t n = nodesArg(args);
+    double p = .01;
+    size_t threads = 1;
+    G g;
+
     if (args.contains("-p") || args.contains("--probability")) {
         std::vector<std::string> pArgs = args.contains("-p") ? args["-p"] : args["--probability"];
         if (pArgs.size() > 1) {
@@ -65,6 +102,20 @@ void runGraphArgs(std::map<std::string, std::vector<std::string>> args) {
         }
     }
 
+    if (args.contains("--threads")) {
+        std::vector<std::string> threadsArgs = args["--threads"];
+        if (threadsArgs.size() != 1) {
+            Logger::error("--threads takes exactly one argument");
+            exit(1);
+        }
+        if (Utils::isNumber(threadsArgs[0])) {
+            threads = std::stoul(threadsArgs[0]);
+        } else {
+            Logger::error("Argument for --threads is not a number");
+            exit(1);
+        }
+    }
+
     if (args.contains("-t") || args.contains("--template")) {
         std::vector<std::string> templateArgs = args.contains("-t") ? args["-t"] : args["--template"];
 
@@ -75,7 +126,7 @@ void runGraphArgs(std::map<std::string, std::vector<std::string>> args) {
         } else if (templateArgs[0] == "bipartite") {
             g = G::createBipartiteGraph(n, Type::Graph::UNDIRECTED, true);
         } else if (templateArgs[0] == "black-hole") {
-            int startIndex = templateArgs.size() > 1 ? Utils::isNumber(templateArgs[1]) ? std::stoi(templateArgs[1]) : 0 : 0;
+            typename G::Vertex startIndex = templateArgs.size() > 1 && Utils::isNumber(templateArgs[1]) ? vertexArg<typename G::Vertex>(templateArgs[1], n, "Second Argument for black-hole is not a number") : 0;
 
             g = G::createBlackHoleGraph(n, Type::Graph::UNDIRECTED, true, startIndex);
         } else if (templateArgs[0] == "star") {
@@ -105,19 +156,14 @@ void runGraphArgs(std::map<std::string, std::vector<std::string>> args) {
 
         if (algoArg[0] == "bfs") {
 
-            int startIndex = 0;
+            typename G::Vertex startIndex = 0;
             if (algoArg.size() > 1) {
-                if (Utils::isNumber(algoArg[1])) {
-                    startIndex = std::stoi(algoArg[1]);
-                } else {
-                    Logger::error("Second Argument for -a | --algo is not a number");
-                    exit(1);
-                }
+                startIndex = vertexArg<typename G::Vertex>(algoArg[1], g.size(), "Second Argument for -a | --algo is not a number");
             }
 
             auto start = std::chrono::high_resolution_clock::now();
 
-            auto vec = g.BFS(startIndex);
+            auto vec = threads == 1 ? g.BFS(startIndex) : g.parallelBFS(startIndex, threads);
 
             auto end = std::chrono::high_resolution_clock::now();
 
@@ -131,7 +177,11 @@ void runGraphArgs(std::map<std::string, std::vector<std::string>> args) {
 
             ss.str("");
 
-            ss << "Time to execute BFS : ";
+            ss << "Time to execute BFS";
+            if (threads != 1) {
+                ss << " (" << (threads == 0 ? std::thread::hardware_concurrency() : threads) << " threads)";
+            }
+            ss << " : ";
 
             ss << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " milliseconds";
 
@@ -139,14 +189,9 @@ void runGraphArgs(std::map<std::string, std::vector<std::string>> args) {
 
         } else if (algoArg[0] == "dfs") {
 
-            int startIndex = 0;
+            typename G::Vertex startIndex = 0;
             if (algoArg.size() > 1) {
-                if (Utils::isNumber(algoArg[1])) {
-                    startIndex = std::stoi(algoArg[1]);
-                } else {
-                    Logger::error("Second Argument for -a | --algo is not a number");
-                    exit(1);
-                }
+                startIndex = vertexArg<typename G::Vertex>(algoArg[1], g.size(), "Second Argument for -a | --algo is not a number");
             }
 
             auto start = std::chrono::high_resolution_clock::now();
@@ -193,4 +238,27 @@ void runGraphArgs(std::map<std::string, std::vector<std::string>> args) {
             exit(1);
         }
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Run the args on the narrowest vertex ids that hold the -n vertices, --unweighted drops the weights so an arc of a list is 4 bytes
+ * @tparam G List::Graph or Matrix::Graph
+ */
+template<template<typename T, typename W = T, typename D = Type::DistanceOf<T, W>> class G>
+void dispatchGraphArgs(std::map<std::string, std::vector<std::string>> args) {
+    bool unweighted = args.contains("--unweighted");
+
+    if (nodesArg(args) <= std::numeric_limits<uint32_t>::max()) {
+        if (unweighted) {
+            runGraphArgs<G<uint32_t, void>>(args);
+        } else {
+            runGraphArgs<G<uint32_t, int32_t>>(args);
+        }
+    } else {
+        if (unweighted) {
+            runGraphArgs<G<uint64_t, void>>(args);
+        } else {
+            runGraphArgs<G<uint64_t, int64_t>>(args);
+        }
+    }
+}
@@ -0,0 +1,272 @@
+#pragma once
+
+#include "Constants.hpp"
+
+#include <bit>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+
+namespace Matrix {
+
+    /**
+     * @brief dst |= src over a row of words
+     */
+    GGRAPH_SIMD_CLONES
+    inline void orRow(uint64_t *dst, const uint64_t *src, size_t words) {
+        for (size_t i = 0; i < words; i++) {
+            dst[i] |= src[i];
+        }
+    }
+
+    /**
+     * @brief Square boolean matrix over the (OR, AND) semiring, a row is size / 64 words of 64 bits
+     * a product row is the OR of the rows of the right matrix selected by the bits of the left one,
+     * so it costs size / 64 word operations per set bit instead of size integer multiplications
+     */
+    class BoolMatrix {
+    private:
+        size_t _size;
+        size_t _words;
+        std::vector<uint64_t> _bits;
+
+        uint64_t *row(size_t row);
+
+        /**
+         * @brief res |= this * other one set bit at a time, for sparse left matrices
+         */
+        void multiplyRows(const BoolMatrix &other, BoolMatrix &res) const;
+
+        /**
+         * @brief res |= this * other with the method of the Four Russians
+         * the rows of other are grouped by 8, the 256 ORs of a group are tabulated
+         * and a byte of a row of this selects one of them
+         */
+        void multiplyFourRussians(const BoolMatrix &other, BoolMatrix &res) const;
+
+    public:
+        BoolMatrix(size_t size);
+
+        /**
+         * @brief Copy packed rows, bit j % 64 of word j / 64 of a row is the cell (row, j)
+         * @param size -> the number of rows and cols
+         * @param rows -> size * ((size + 63) / 64) words
+         */
+        BoolMatrix(size_t size, const uint64_t *rows);
+
+        static BoolMatrix identity(size_t size);
+
+        size_t size() const;
+
+        /**
+         * @brief Number of 64 bits words in a row
+         */
+        size_t words() const;
+
+        const uint64_t *row(size_t row) const;
+
+        bool test(size_t row, size_t col) const;
+
+        void set(size_t row, size_t col, bool value = true);
+
+        /**
+         * @brief Number of true cells
+         */
+        size_t count() const;
+
+        BoolMatrix operator*(const BoolMatrix &other) const;
+
+        BoolMatrix operator|(const BoolMatrix &other) const;
+
+        BoolMatrix &operator|=(const BoolMatrix &other);
+
+        bool operator==(const BoolMatrix &other) const;
+
+        /**
+         * @brief matrix ^ value by repeated squaring, (i, j) is true if there is a walk of exactly value edges from i to j
+         */
+        static BoolMatrix power(const BoolMatrix &matrix, int value);
+
+        /**
+         * @brief matrix | matrix ^ 2 | ... | matrix ^ value with O(log value) products,
+         * (i, j) is true if there is a walk of 1 to value edges from i to j
+         */
+        static BoolMatrix accumulate(const BoolMatrix &matrix, int value);
+
+        friend std::ostream &operator<<(std::ostream &os, const BoolMatrix &matrix) {
+            for (size_t i = 0; i < matrix.size(); i++) {
+                for (size_t j = 0; j < matrix.size(); j++) {
+                    os << matrix.test(i, j) << " ";
+                }
+                os << std::endl;
+            }
+            return os;
+        };
+    };
+}
+
+inline Matrix::BoolMatrix::BoolMatrix(size_t size) : _size(size), _words((size + 63) / 64), _bits(size * ((size + 63) / 64), 0) {}
+
+inline Matrix::BoolMatrix::BoolMatrix(size_t size, const uint64_t *rows) : _size(size), _words((size + 63) / 64), _bits(rows, rows + size * ((size + 63) / 64)) {}
+
+inline Matrix::BoolMatrix Matrix::BoolMatrix::identity(size_t size) {
+    BoolMatrix res(size);
+    for (size_t i = 0; i < size; i++) {
+        res.set(i, i);
+    }
+    return res;
+}
+
+inline size_t Matrix::BoolMatrix::size() const {
+    return _size;
+}
+
+inline size_t Matrix::BoolMatrix::words() const {
+    return _words;
+}
+
+inline uint64_t *Matrix::BoolMatrix::row(size_t row) {
+    return _bits.data() + row * _words;
+}
+
+inline const uint64_t *Matrix::BoolMatrix::row(size_t row) const {
+    return _bits.data() + row * _words;
+}
+
+inline bool Matrix::BoolMatrix::test(size_t row, size_t col) const {
+    if (row >= _size || col >= _size) {
+        throw std::out_of_range("Matrix::BoolMatrix::test() -- index out of range !");
+    }
+    return (_bits[row * _words + col / 64] >> (col % 64)) & 1;
+}
+
+inline void Matrix::BoolMatrix::set(size_t row, size_t col, bool value) {
+    if (row >= _size || col >= _size) {
+        throw std::out_of_range("Matrix::BoolMatrix::set() -- index out of range !");
+    }
+    uint64_t bit = uint64_t(1) << (col % 64);
+    if (value) {
+        _bits[row * _words + col / 64] |= bit;
+    } else {
+        _bits[row * _words + col / 64] &= ~bit;
+    }
+}
+
+inline size_t Matrix::BoolMatrix::count() const {
+    size_t res = 0;
+    for (uint64_t word : _bits) {
+        res += std::popcount(word);
+    }
+    return res;
+}
+
+inline void Matrix::BoolMatrix::multiplyRows(const BoolMatrix &other, BoolMatrix &res) const {
+    for (size_t i = 0; i < _size; i++) {
+        const uint64_t *a = this->row(i);
+        uint64_t *c = res.row(i);
+        for (size_t w = 0; w < _words; w++) {
+            for (uint64_t bits = a[w]; bits != 0; bits &= bits - 1) {
+                orRow(c, other.row(w * 64 + std::countr_zero(bits)), _words);
+            }
+        }
+    }
+}
+
+inline void Matrix::BoolMatrix::multiplyFourRussians(const BoolMatrix &other, BoolMatrix &res) const {
+    std::vector<uint64_t> table(256 * _words);
+
+    for (size_t k = 0; k < _size; k += 8) {
+        size_t group = std::min<size_t>(8, _size - k);
+
+        // table[m] is the OR of the rows k + j of other for every bit j of m, built from m with its lowest bit cleared
+        for (size_t m = 1; m < (size_t(1) << group); m++) {
+            uint64_t *entry = table.data() + m * _words;
+            const uint64_t *previous = table.data() + (m & (m - 1)) * _words;
+            const uint64_t *added = other.row(k + std::countr_zero(m));
+            for (size_t w = 0; w < _words; w++) {
+                entry[w] = previous[w] | added[w];
+            }
+        }
+
+        for (size_t i = 0; i < _size; i++) {
+            size_t byte = (this->row(i)[k / 64] >> (k % 64)) & 0xff;
+            if (byte != 0) {
+                orRow(res.row(i), table.data() + byte * _words, _words);
+            }
+        }
+    }
+}
+
+inline Matrix::BoolMatrix Matrix::BoolMatrix::operator*(const BoolMatrix &other) const {
+    if (_size != other._size) {
+        throw std::invalid_argument("Matrix::BoolMatrix::operator*() -- incompatible sizes !");
+    }
+
+    BoolMatrix res(_size);
+
+    // one row OR per set bit, against a table of 256 rows per group of 8 rows and one row OR per non zero byte
+    size_t perBit = this->count();
+    size_t fourRussians = (_size + 7) / 8 * 256 + _size * ((_size + 7) / 8);
+    if (perBit <= fourRussians / 2) {
+        this->multiplyRows(other, res);
+    } else {
+        this->multiplyFourRussians(other, res);
+    }
+
+    return res;
+}
+
+inline Matrix::BoolMatrix Matrix::BoolMatrix::operator|(const BoolMatrix &other) const {
+    BoolMatrix res(*this);
+    res |= other;
+    return res;
+}
+
+inline Matrix::BoolMatrix &Matrix::BoolMatrix::operator|=(const BoolMatrix &other) {
+    if (_size != other._size) {
+        throw std::invalid_argument("Matrix::BoolMatrix::operator|=() -- incompatible sizes !");
+    }
+    orRow(_bits.data(), other._bits.data(), _bits.size());
+    return *this;
+}
+
+inline bool Matrix::BoolMatrix::operator==(const BoolMatrix &other) const {
+    return _size == other._size && _bits == other._bits;
+}
+
+inline Matrix::BoolMatrix Matrix::BoolMatrix::power(const BoolMatrix &matrix, int value) {
+    BoolMatrix res = BoolMatrix::identity(matrix.size());
+    BoolMatrix square = matrix;
+    while (value > 0) {
+        if (value % 2 == 1) {
+            res = res * square;
+        }
+        value /= 2;
+        if (value > 0) {
+            square = square * square;
+        }
+    }
+    return res;
+}
+
+inline Matrix::BoolMatrix Matrix::BoolMatrix::accumulate(const BoolMatrix &matrix, int value) {
+    if (value <= 0) {
+        return BoolMatrix(matrix.size());
+    }
+
+    // sum = matrix | ... | matrix ^ done and last = matrix ^ done, following the bits of value from the highest one
+    BoolMatrix sum = matrix;
+    BoolMatrix last = matrix;
+    for (int bit = std::bit_width(unsigned(value)) - 2; bit >= 0; bit--) {
+        sum |= last * sum;
+        last = last * last;
+        if ((value >> bit) & 1) {
+            last = last * matrix;
+            sum |= last;
+        }
+    }
+    return sum;
+}
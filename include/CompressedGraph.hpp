@@ -0,0 +1,423 @@
+#pragma once
+
+#include "ListGraph.hpp"
+#include "Utils.hpp"
+#include "Logger.hpp"
+#include "Varint.hpp"
+#include "TraversalWorkspace.hpp"
+#include "Eccentricity.hpp"
+#include "DepthFirstSearch.hpp"
+
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <algorithm>
+#include <exception>
+
+namespace Compressed {
+    /**
+     * @brief Read-only snapshot of a List::Graph for the graphs whose pairs do not fit in memory
+     * every neighbour list is sorted and its gaps are stored in group varint, the first one relative to the vertex (zigzag),
+     * so an arc takes 1.25 bytes when the ids are close and 3.25 bytes up to gaps of 2^24
+     * the kernels decode the lists on the fly, the weights are dropped and the distances count edges
+     * @tparam T the vertex ids, 32 bits at most: the DFS cursor packs the last neighbour and a byte position in 64 bits
+     * @tparam D the distances
+     */
+    template<typename T, typename D = Type::DistanceOf<T, void>>
+    class Graph {
+        static_assert(sizeof(T) <= 4, "Compressed::Graph packs a vertex id in 32 bits");
+
+    private:
+        // the list of v is bytes[offsets[v] .. offsets[v + 1]), followed by Varint::padding bytes at the end
+        std::vector<size_t> offsets;
+        std::vector<uint8_t> bytes;
+        size_t _size;
+        size_t _arcs = 0;
+
+    protected:
+        Type::Graph _d;
+
+        /**
+         * @brief DFS cursor, next is (last neighbour << 32) | (offset of the group in the list of v << 2) | index in the group,
+         * 0 before the first neighbour
+         */
+        bool nextNeighbour(T v, size_t &next, T &z) const;
+
+        void BFSVisit(T v, TraversalWorkspace<T, D> &workspace, T target = -1) const;
+
+    public:
+        Graph();
+
+        /**
+         * @brief Compress a list graph
+         * @param graph -> the list graph to copy, any weight type, it is read only once
+         */
+        template<typename W, typename E>
+        explicit Graph(const List::Graph<T, W, E> &graph);
+
+        [[nodiscard]] size_t size() const;
+
+        [[nodiscard]] Type::Graph directed() const;
+
+        /**
+         * @brief Number of stored arcs (an undirected edge is stored twice)
+         */
+        [[nodiscard]] size_t arcs() const;
+
+        /**
+         * @brief Bytes of the encoded lists, the offsets excluded
+         */
+        [[nodiscard]] size_t encodedBytes() const;
+
+        /**
+         * @brief Get the degres of a vertex, one pass over its bytes
+         * @param vertex -> the vertex
+         * @return the degres of the vertex
+         */
+        int degres(T vertex) const;
+
+        /**
+         * @brief Decode the list of a vertex, f(z) is called on every neighbour in increasing order
+         */
+        template<typename F>
+        void forEachNeighbour(T vertex, F f) const;
+
+        /**
+         * @brief Targets of the edges leaving a vertex
+         * @param vertex -> the vertex
+         * @return a decoded copy of the sorted list
+         */
+        std::vector<T> neighbours(T vertex) const;
+
+        /**
+         * @brief Get the BFS of the graph
+         * @return a vector of the BFS
+         */
+        std::vector<T> BFS(T start = 0) const;
+
+        /**
+         * @brief Get the BFS of the graph without allocating, in the memory of a workspace
+         * @return the BFS, valid until the next run of the workspace
+         */
+        std::span<const T> BFS(T start, TraversalWorkspace<T, D> &workspace) const;
+
+        /**
+         * @brief Get the DFS of the graph, with an explicit stack so deep graphs are safe
+         * @param type PREORDER or POSTORDER
+         * @return a vector of the DFS
+         */
+        std::vector<T> DFS(T start = 0, Type::Print type = Type::Print::PREORDER) const;
+
+        /**
+         * @brief Get the whole DFS forest: preorder, postorder, parents, discovery and finish times
+         * @param start -> the first root, the other roots are taken in increasing order
+         * @return the DepthFirst::Tree
+         */
+        DepthFirst::Tree<T> DFSTree(T start = 0) const;
+
+        /**
+         * @brief Find a cycle in O(n + m), a directed graph only follows the direction of its edges
+         * @return the vertices of a cycle, the first one repeated at the end, if one exists else nothing
+         */
+        std::optional<std::vector<T>> cycle() const;
+
+        /**
+         * @brief Number of edges from a vertex (BFS)
+         * @param v -> the vertex
+         * @return a vector of the distance from v, -1 if not reachable
+         */
+        std::vector<D> distanceFrom(T v) const;
+
+        /**
+         * @brief Number of edges from a vertex without allocating
+         * @param workspace -> workspace.distance(w) and workspace.parent(w) hold the result until its next run
+         */
+        void distanceFrom(T v, TraversalWorkspace<T, D> &workspace) const;
+
+        /**
+         * @brief Return a path with the fewest edges between two vertices
+         * @return std::pair(number of edges, std::vector(vertices of the path))
+         */
+        std::optional<std::pair<D, std::vector<T>>> path(T from, T to) const;
+
+        /**
+         * @brief Get the eccentricity of a vertex
+         * @return std::pair(distance, longest vertex)
+         */
+        std::optional<std::pair<D, T>> eccentricity(T v) const;
+
+        /**
+         * @brief Get the radius of the graph
+         * @return std::pair(distance, std::pair(from, to))
+         * exact, most vertices are pruned with eccentricity bounds on undirected graphs
+         */
+        std::optional<std::pair<D, std::pair<T, T>>> radius() const;
+
+        /**
+         * @brief Get the diameter of the graph
+         * @return std::pair(distance, std::pair(from, to))
+         * exact, most vertices are pruned with eccentricity bounds on undirected graphs
+         */
+        std::optional<std::pair<D, std::pair<T, T>>> diameter() const;
+    };
+}
+
+template<typename T, typename D>
+Compressed::Graph<T, D>::Graph() : offsets(1, 0), _size(0), _d(Type::Graph::UNDIRECTED) {}
+
+template<typename T, typename D>
+template<typename W, typename E>
+Compressed::Graph<T, D>::Graph(const List::Graph<T, W, E> &graph) : _size(graph.size()), _d(graph.directed()) {
+    Logger::debug("Creating compressed graph from list graph of size " + std::to_string(graph.size()) + "...");
+
+    this->offsets.reserve(this->_size + 1);
+    this->offsets.push_back(0);
+
+    std::vector<T> list;
+    std::vector<uint32_t> gaps;
+    for (size_t v = 0; v < this->_size; v++) {
+        list.clear();
+        for (const auto &arc : graph[T(v)]) {
+            list.push_back(arc.first);
+        }
+        std::sort(list.begin(), list.end());
+
+        gaps.resize(list.size());
+        for (size_t i = 0; i < list.size(); i++) {
+            gaps[i] = i == 0 ? Varint::zigzag(int32_t(uint32_t(list[0]) - uint32_t(v))) : uint32_t(list[i]) - uint32_t(list[i - 1]);
+        }
+        Varint::encode(gaps, this->bytes);
+
+        if (this->bytes.size() - this->offsets.back() >= (size_t(1) << 30)) {
+            throw std::invalid_argument("The list of a vertex must take less than 2^30 bytes");
+        }
+        this->_arcs += list.size();
+        this->offsets.push_back(this->bytes.size());
+    }
+    this->bytes.resize(this->bytes.size() + Varint::padding);
+    this->bytes.shrink_to_fit();
+}
+
+template<typename T, typename D>
+size_t Compressed::Graph<T, D>::size() const {
+    return this->_size;
+}
+
+template<typename T, typename D>
+Type::Graph Compressed::Graph<T, D>::directed() const {
+    return this->_d;
+}
+
+template<typename T, typename D>
+size_t Compressed::Graph<T, D>::arcs() const {
+    return this->_arcs;
+}
+
+template<typename T, typename D>
+size_t Compressed::Graph<T, D>::encodedBytes() const {
+    return this->bytes.size() - Varint::padding;
+}
+
+template<typename T, typename D>
+int Compressed::Graph<T, D>::degres(T vertex) const {
+    if (vertex < 0 || vertex > this->size() - 1) {
+        throw std::invalid_argument("'edge' must be between 0 and the size of the graph !");
+    }
+
+    int res = 0;
+    const uint8_t *end = this->bytes.data() + this->offsets[vertex + 1];
+    for (const uint8_t *p = this->bytes.data() + this->offsets[vertex]; p != end; p += 1 + Varint::groupBytes(*p)) {
+        size_t count = Varint::groupCount(p, end);
+        res += int(count);
+        if (count < 4) {
+            break;
+        }
+    }
+    return res;
+}
+
+template<typename T, typename D>
+template<typename F>
+void Compressed::Graph<T, D>::forEachNeighbour(T vertex, F f) const {
+    uint32_t z = uint32_t(vertex);
+    bool first = true;
+    Varint::decode(this->bytes.data() + this->offsets[vertex], this->bytes.data() + this->offsets[vertex + 1], [&](uint32_t gap) {
+        z += first ? uint32_t(Varint::unzigzag(gap)) : gap;
+        first = false;
+        f(T(z));
+    });
+}
+
+template<typename T, typename D>
+std::vector<T> Compressed::Graph<T, D>::neighbours(T vertex) const {
+    std::vector<T> res;
+    this->forEachNeighbour(vertex, [&res](T z) {
+        res.push_back(z);
+    });
+    return res;
+}
+
+template<typename T, typename D>
+std::vector<T> Compressed::Graph<T, D>::BFS(T start) const {
+    Logger::debug("BFS algorithm starting...");
+
+    TraversalWorkspace<T, D> workspace(this->size());
+    std::span<const T> order = this->BFS(start, workspace);
+    return std::vector<T>(order.begin(), order.end());
+}
+
+template<typename T, typename D>
+std::span<const T> Compressed::Graph<T, D>::BFS(T start, TraversalWorkspace<T, D> &workspace) const {
+    workspace.reset(this->size());
+
+    this->BFSVisit(start, workspace);
+    for (size_t v = 0; v < this->size(); v++) {
+        if (!workspace.reached(T(v))) {
+            this->BFSVisit(T(v), workspace);
+        }
+    }
+
+    return workspace.order();
+}
+
+template<typename T, typename D>
+void Compressed::Graph<T, D>::BFSVisit(T v, TraversalWorkspace<T, D> &workspace, T target) const {
+    // the order is the queue, the vertices from head are still to be expanded
+    size_t head = workspace.order().size();
+    workspace.reach(v, 0, -1);
+    while (head < workspace.order().size()) {
+        T w = workspace.order()[head++];
+        if (w == target) {
+            return;
+        }
+        D level = workspace.distance(w) + 1;
+        this->forEachNeighbour(w, [&workspace, w, level](T z) {
+            if (!workspace.reached(z)) {
+                workspace.reach(z, level, w);
+            }
+        });
+    }
+}
+
+template<typename T, typename D>
+bool Compressed::Graph<T, D>::nextNeighbour(T v, size_t &next, T &z) const {
+    const uint8_t *list = this->bytes.data() + this->offsets[v];
+    const uint8_t *end = this->bytes.data() + this->offsets[v + 1];
+    const uint8_t *group = list + ((next & 0xffffffff) >> 2);
+    if (group == end) {
+        return false;
+    }
+
+    unsigned control = *group;
+    unsigned k = next & 3;
+    const uint8_t *data = group + 1;
+    for (unsigned j = 0; j < k; j++) {
+        data += ((control >> (2 * j)) & 3) + 1;
+    }
+    unsigned bytes = ((control >> (2 * k)) & 3) + 1;
+    uint32_t gap = Varint::load(data, bytes);
+    z = T(next == 0 ? uint32_t(v) + uint32_t(Varint::unzigzag(gap)) : uint32_t(next >> 32) + gap);
+
+    // the data of the last value of a group ends where the next group starts
+    size_t cursor = k + 1 < Varint::groupCount(group, end) ? (size_t(group - list) << 2) | (k + 1) : size_t(data + bytes - list) << 2;
+    next = (size_t(uint32_t(z)) << 32) | cursor;
+    return true;
+}
+
+template<typename T, typename D>
+std::vector<T> Compressed::Graph<T, D>::DFS(T start, Type::Print type) const {
+    Logger::debug("DFS algorithm starting...");
+
+    DepthFirst::OrderVisitor<T> visitor(type);
+    visitor.res.reserve(this->size());
+    DepthFirst::forest(this->size(), start, [this](T v, size_t &next, T &z) {
+        return this->nextNeighbour(v, next, z);
+    }, visitor);
+
+    return visitor.res;
+}
+
+template<typename T, typename D>
+DepthFirst::Tree<T> Compressed::Graph<T, D>::DFSTree(T start) const {
+    Logger::debug("DFS tree algorithm starting...");
+
+    return DepthFirst::tree(this->size(), start, [this](T v, size_t &next, T &z) {
+        return this->nextNeighbour(v, next, z);
+    });
+}
+
+template<typename T, typename D>
+std::optional<std::vector<T>> Compressed::Graph<T, D>::cycle() const {
+    Logger::debug("Cycle algorithm starting...");
+
+    DepthFirst::CycleVisitor<T> visitor(this->size(), this->_d == Type::DIRECTED);
+    DepthFirst::forest(this->size(), T(0), [this](T v, size_t &next, T &z) {
+        return this->nextNeighbour(v, next, z);
+    }, visitor);
+
+    if (visitor.stopped) {
+        return visitor.cycle;
+    }
+    return std::nullopt;
+}
+
+template<typename T, typename D>
+std::vector<D> Compressed::Graph<T, D>::distanceFrom(T v) const {
+    Logger::debug("Distance from " + std::to_string(v) + " algorithm starting...");
+
+    TraversalWorkspace<T, D> workspace(this->size());
+    this->distanceFrom(v, workspace);
+
+    std::vector<D> distance(this->size());
+    for (size_t w = 0; w < this->size(); w++) {
+        distance[w] = workspace.distance(T(w));
+    }
+    return distance;
+}
+
+template<typename T, typename D>
+void Compressed::Graph<T, D>::distanceFrom(T v, TraversalWorkspace<T, D> &workspace) const {
+    workspace.reset(this->size());
+    this->BFSVisit(v, workspace);
+}
+
+template<typename T, typename D>
+std::optional<std::pair<D, std::vector<T>>> Compressed::Graph<T, D>::path(T from, T to) const {
+    Logger::debug("Path algorithm starting...");
+    if (from < 0 || from > this->size() - 1 || to < 0 || to > this->size() - 1) {
+        throw std::invalid_argument("int param have to be between 0 and the _size of the graph");
+    }
+
+    TraversalWorkspace<T, D> workspace(this->size());
+    this->BFSVisit(from, workspace, to);
+
+    if (!workspace.reached(to)) {
+        return std::nullopt;
+    }
+    std::span<const T> path = workspace.pathTo(to);
+    return std::make_pair(workspace.distance(to), std::vector<T>(path.begin(), path.end()));
+}
+
+template<typename T, typename D>
+std::optional<std::pair<D, T>> Compressed::Graph<T, D>::eccentricity(T v) const {
+    TraversalWorkspace<T, D> workspace(this->size());
+    this->distanceFrom(v, workspace);
+    return Eccentricity::farthest(v, workspace);
+}
+
+template<typename T, typename D>
+std::optional<std::pair<D, std::pair<T, T>>> Compressed::Graph<T, D>::radius() const {
+    Logger::debug("Radius algorithm starting...");
+    return Eccentricity::boundingDiameters<T, D>(this->size(), this->_d == Type::UNDIRECTED, false, [this](T v, TraversalWorkspace<T, D> &workspace) {
+        this->distanceFrom(v, workspace);
+    });
+}
+
+template<typename T, typename D>
+std::optional<std::pair<D, std::pair<T, T>>> Compressed::Graph<T, D>::diameter() const {
+    Logger::debug("Diameter algorithm starting...");
+    return Eccentricity::boundingDiameters<T, D>(this->size(), this->_d == Type::UNDIRECTED, true, [this](T v, TraversalWorkspace<T, D> &workspace) {
+        this->distanceFrom(v, workspace);
+    });
+}
@@ -1,3 +1,10 @@
 #pragma once
 
-#define GRAPH_VERSION "0.0.1"
\ No newline at end of file
+#define GRAPH_VERSION "0.0.1"
+
+// hot loops are compiled for AVX-512, AVX2 and plain x86-64, the loader picks the best one for the CPU
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+#define GGRAPH_SIMD_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define GGRAPH_SIMD_CLONES
+#endif
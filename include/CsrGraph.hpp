@@ -0,0 +1,473 @@
+#pragma once
+
+#include "ListGraph.hpp"
+#include "Utils.hpp"
+#include "Logger.hpp"
+#include "ShortestPath.hpp"
+#include "TraversalWorkspace.hpp"
+#include "Eccentricity.hpp"
+#include "DepthFirstSearch.hpp"
+
+#include <queue>
+#include <span>
+#include <optional>
+#include <exception>
+#include <vector>
+#include <type_traits>
+
+namespace Csr {
+    /**
+     * @brief Frozen compressed sparse row snapshot of a List::Graph
+     * the neighbours of v are targets[offsets[v] .. offsets[v + 1]) and their weights sit at the same index in weights
+     * @tparam T the vertex ids
+     * @tparam W the weights of the edges, void for an unweighted graph which has no weight array
+     * @tparam D the distances, the weights by default, a signed number of edges for an unweighted graph
+     */
+    template<typename T, typename W = T, typename D = Type::DistanceOf<T, W>>
+    class Graph {
+    public:
+        using Vertex = T;
+        using Weight = Type::WeightOf<W>;
+
+    private:
+        std::vector<size_t> offsets;
+        std::vector<T> targets;
+        std::vector<Weight> weights;
+        size_t _size;
+        Weight _minWeight = 0;
+        Weight _maxWeight = 0;
+
+        /**
+         * @brief Weight of the arc at that index of targets, 1 when the graph is unweighted
+         */
+        D weightAt(size_t arc) const;
+
+    protected:
+        Type::Graph _d;
+
+        void BFSVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &res) const;
+
+        bool nextNeighbour(T v, size_t &next, T &z) const;
+
+        void distanceFromSourceVisit(T v, std::vector<T> &parent, std::vector<D> &distance, T target = -1) const;
+
+        void distanceFromSourceVisit(T v, TraversalWorkspace<T, D> &workspace) const;
+
+        bool isBipartiteVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<Color> &partie) const;
+
+    public:
+        Graph();
+
+        /**
+         * @brief Freeze a list graph into a csr graph
+         * @param graph -> the list graph to copy, it is read only once, its distances may be of another type
+         */
+        template<typename E>
+        explicit Graph(const List::Graph<T, W, E>& graph);
+
+        [[nodiscard]] size_t size() const;
+
+        [[nodiscard]] Type::Graph directed() const;
+
+        /**
+         * @brief Number of stored arcs (an undirected edge is stored twice)
+         */
+        [[nodiscard]] size_t arcs() const;
+
+        /**
+         * @brief Get the degres of a vertex
+         * @param vertex -> the vertex
+         * @return the degres of the vertex
+         */
+        int degres(T vertex) const;
+
+        /**
+         * @brief Targets of the edges leaving a vertex
+         * @param vertex -> the vertex
+         * @return a view on the contiguous target array
+         */
+        std::span<const T> neighbours(T vertex) const;
+
+        /**
+         * @brief Weights of the edges leaving a vertex, in the same order as neighbours(vertex)
+         * @param vertex -> the vertex
+         * @return a view on the contiguous weight array
+         */
+        std::span<const Weight> weightsOf(T vertex) const requires (!std::is_void_v<W>);
+
+        /**
+         * @brief Get the BFS of the graph
+         * @return a vector of the BFS
+         */
+        std::vector<T> BFS(T start = 0) const;
+
+        /**
+         * @brief Get the DFS of the graph, with an explicit stack so deep graphs are safe
+         * @param type PREORDER or POSTORDER
+         * @return a vector of the DFS
+         */
+        std::vector<T> DFS(T start = 0, Type::Print type = Type::Print::PREORDER) const;
+
+        /**
+         * @brief Get the whole DFS forest: preorder, postorder, parents, discovery and finish times
+         * @param start -> the first root, the other roots are taken in increasing order
+         * @return the DepthFirst::Tree
+         */
+        DepthFirst::Tree<T> DFSTree(T start = 0) const;
+
+        /**
+         * @brief Check if the graph is bipartite
+         * @return true if the graph is bipartite else false
+         */
+        bool isBipartite() const;
+
+        /**
+         * @brief Find a cycle in O(n + m), a directed graph only follows the direction of its edges
+         * @return the vertices of a cycle, the first one repeated at the end, if one exists else nothing
+         */
+        std::optional<std::vector<T>> cycle() const;
+
+        /**
+         * @brief Shortest distance from any vertex (Dijkstra, the weights must not be negative)
+         * @param v -> the vertex
+         * @return a vector of the distance from v, -1 if not reachable
+         */
+        std::vector<D> distanceFrom(T v) const;
+
+        /**
+         * @brief Distance from 0
+         * @return a vector of the distance from 0
+         */
+        std::vector<D> distanceFromSource() const;
+
+        /**
+         * @brief Return the shortest path between two vertices
+         * @param from -> the starting point
+         * @param to -> the ending point
+         * @return std::pair(length of the path, std::vector(vertices of the path))
+         */
+        std::optional<std::pair<D, std::vector<T>>> path(T from, T to) const;
+
+        /**
+         * @brief Get the eccentricity of a vertex
+         * @param v -> the vertex
+         * @return std::pair(distance, longest vertex)
+         */
+        std::optional<std::pair<D, T>> eccentricity(T v) const;
+
+        /**
+         * @brief Get the radius of the graph
+         * @return std::pair(distance, std::pair(from, to))
+         * exact, most vertices are pruned with eccentricity bounds on undirected graphs
+         */
+        std::optional<std::pair<D, std::pair<T, T>>> radius() const;
+
+        /**
+         * @brief Get the diameter of the graph
+         * @return std::pair(distance, std::pair(from, to))
+         * exact, most vertices are pruned with eccentricity bounds on undirected graphs
+         */
+        std::optional<std::pair<D, std::pair<T, T>>> diameter() const;
+    };
+}
+
+template<typename T, typename W, typename D>
+Csr::Graph<T, W, D>::Graph() : offsets(1, 0), _size(0), _d(Type::Graph::UNDIRECTED) {}
+
+template<typename T, typename W, typename D>
+template<typename E>
+Csr::Graph<T, W, D>::Graph(const List::Graph<T, W, E> &graph) : _size(graph.size()), _d(graph.directed()) {
+    Logger::debug("Creating csr graph from list graph of size " + std::to_string(graph.size()) + "...");
+
+    this->offsets = std::vector<size_t>(this->_size + 1, 0);
+    for (size_t v = 0; v < this->_size; v++) {
+        this->offsets[v + 1] = this->offsets[v] + graph[T(v)].size();
+    }
+
+    this->targets.reserve(this->offsets[this->_size]);
+    if constexpr (!std::is_void_v<W>) {
+        this->weights.reserve(this->offsets[this->_size]);
+    }
+    for (size_t v = 0; v < this->_size; v++) {
+        for (const auto &arc : graph[T(v)]) {
+            this->targets.push_back(arc.first);
+            if constexpr (!std::is_void_v<W>) {
+                this->weights.push_back(arc.second);
+                this->_minWeight = std::min(this->_minWeight, arc.second);
+                this->_maxWeight = std::max(this->_maxWeight, arc.second);
+            }
+        }
+    }
+}
+
+template<typename T, typename W, typename D>
+D Csr::Graph<T, W, D>::weightAt(size_t arc) const {
+    if constexpr (std::is_void_v<W>) {
+        return D(1);
+    } else {
+        return D(this->weights[arc]);
+    }
+}
+
+template<typename T, typename W, typename D>
+size_t Csr::Graph<T, W, D>::size() const {
+    return this->_size;
+}
+
+template<typename T, typename W, typename D>
+Type::Graph Csr::Graph<T, W, D>::directed() const {
+    return this->_d;
+}
+
+template<typename T, typename W, typename D>
+size_t Csr::Graph<T, W, D>::arcs() const {
+    return this->targets.size();
+}
+
+template<typename T, typename W, typename D>
+int Csr::Graph<T, W, D>::degres(T vertex) const {
+    if (vertex < 0 || vertex > this->size() - 1) {
+        throw std::invalid_argument("'edge' must be between 0 and the size of the graph !");
+    }
+
+    return int(this->offsets[vertex + 1] - this->offsets[vertex]);
+}
+
+template<typename T, typename W, typename D>
+std::span<const T> Csr::Graph<T, W, D>::neighbours(T vertex) const {
+    return std::span<const T>(this->targets.data() + this->offsets[vertex], this->offsets[vertex + 1] - this->offsets[vertex]);
+}
+
+template<typename T, typename W, typename D>
+std::span<const typename Csr::Graph<T, W, D>::Weight> Csr::Graph<T, W, D>::weightsOf(T vertex) const requires (!std::is_void_v<W>) {
+    return std::span<const Weight>(this->weights.data() + this->offsets[vertex], this->offsets[vertex + 1] - this->offsets[vertex]);
+}
+
+template<typename T, typename W, typename D>
+std::vector<T> Csr::Graph<T, W, D>::BFS(T start) const {
+    Logger::debug("BFS algorithm starting...");
+
+    std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
+    std::vector<T> parent = std::vector<T>(this->size(), -1);
+    std::vector<T> res;
+    res.reserve(this->size());
+
+    this->BFSVisit(start, color, parent, res);
+    for (T v = 0; v < this->size(); v++) {
+        if (color[v] == Color::BLUE) {
+            this->BFSVisit(v, color, parent, res);
+        }
+    }
+
+    return res;
+}
+
+template<typename T, typename W, typename D>
+void Csr::Graph<T, W, D>::BFSVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &res) const {
+    std::queue<T> q;
+    color[v] = Color::WHITE;
+    q.push(v);
+    while (!q.empty()) {
+        T w = q.front();
+        q.pop();
+        for (T z : this->neighbours(w)) {
+            if (color[z] == Color::BLUE) {
+                color[z] = Color::WHITE;
+                parent[z] = w;
+                q.push(z);
+            }
+        }
+        color[w] = Color::RED;
+        res.push_back(w);
+    }
+}
+
+template<typename T, typename W, typename D>
+std::vector<T> Csr::Graph<T, W, D>::DFS(T start, Type::Print type) const {
+    Logger::debug("DFS algorithm starting...");
+
+    DepthFirst::OrderVisitor<T> visitor(type);
+    visitor.res.reserve(this->size());
+    DepthFirst::forest(this->size(), start, [this](T v, size_t &next, T &z) {
+        return this->nextNeighbour(v, next, z);
+    }, visitor);
+
+    return visitor.res;
+}
+
+template<typename T, typename W, typename D>
+DepthFirst::Tree<T> Csr::Graph<T, W, D>::DFSTree(T start) const {
+    Logger::debug("DFS tree algorithm starting...");
+
+    return DepthFirst::tree(this->size(), start, [this](T v, size_t &next, T &z) {
+        return this->nextNeighbour(v, next, z);
+    });
+}
+
+template<typename T, typename W, typename D>
+bool Csr::Graph<T, W, D>::nextNeighbour(T v, size_t &next, T &z) const {
+    size_t edge = this->offsets[v] + next;
+    if (edge == this->offsets[v + 1]) {
+        return false;
+    }
+    z = this->targets[edge];
+    next++;
+    return true;
+}
+
+template<typename T, typename W, typename D>
+std::optional<std::vector<T>> Csr::Graph<T, W, D>::cycle() const {
+    Logger::debug("Cycle algorithm starting...");
+
+    DepthFirst::CycleVisitor<T> visitor(this->size(), this->_d == Type::DIRECTED);
+    DepthFirst::forest(this->size(), T(0), [this](T v, size_t &next, T &z) {
+        return this->nextNeighbour(v, next, z);
+    }, visitor);
+
+    if (visitor.stopped) {
+        return visitor.cycle;
+    }
+    return std::nullopt;
+}
+
+template<typename T, typename W, typename D>
+std::vector<D> Csr::Graph<T, W, D>::distanceFrom(T v) const {
+    Logger::debug("Distance from " + std::to_string(v) + " algorithm starting...");
+    std::vector<T> parent = std::vector<T>(this->size(), -1);
+    std::vector<D> distance = std::vector<D>(this->size(), -1);
+
+    this->distanceFromSourceVisit(v, parent, distance);
+
+    return distance;
+}
+
+template<typename T, typename W, typename D>
+std::vector<D> Csr::Graph<T, W, D>::distanceFromSource() const {
+    return this->distanceFrom(0);
+}
+
+template<typename T, typename W, typename D>
+void Csr::Graph<T, W, D>::distanceFromSourceVisit(T v, std::vector<T> &parent, std::vector<D> &distance, T target) const {
+    ShortestPath::dijkstra(v, distance, parent, D(this->_minWeight), D(this->_maxWeight), [this](T w, auto &&relax) {
+        for (size_t e = this->offsets[w]; e < this->offsets[w + 1]; e++) {
+            relax(this->targets[e], this->weightAt(e));
+        }
+    }, target);
+}
+
+template<typename T, typename W, typename D>
+void Csr::Graph<T, W, D>::distanceFromSourceVisit(T v, TraversalWorkspace<T, D> &workspace) const {
+    workspace.reset(this->size());
+    workspace.queues().with(D(this->_minWeight), D(this->_maxWeight), [&](auto &queue) {
+        ShortestPath::settle(v, workspace, queue, [this](T w, auto &&relax) {
+            for (size_t e = this->offsets[w]; e < this->offsets[w + 1]; e++) {
+                relax(this->targets[e], this->weightAt(e));
+            }
+        });
+    });
+}
+
+template<typename T, typename W, typename D>
+bool Csr::Graph<T, W, D>::isBipartite() const {
+    Logger::debug("Bipartite algorithm starting...");
+    std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
+    std::vector<Color> partie = std::vector<Color>(this->size(), Color::NONE);
+    std::vector<T> parent = std::vector<T>(this->size(), -1);
+
+    for (T v = 0; v < this->size(); v++) {
+        if (color[v] == Color::BLUE) {
+            partie[v] = Color::BLUE;
+            if (!this->isBipartiteVisit(v, color, parent, partie)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template<typename T, typename W, typename D>
+bool Csr::Graph<T, W, D>::isBipartiteVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<Color> &partie) const {
+    std::queue<T> q;
+    color[v] = Color::WHITE;
+    q.push(v);
+    while (!q.empty()) {
+        T w = q.front();
+        q.pop();
+        Color nextColor = partie[w] == Color::BLUE ? Color::RED : Color::BLUE;
+        for (T z : this->neighbours(w)) {
+            if (partie[z] != Color::NONE) {
+                if (partie[z] == partie[w]) {
+                    Logger::debug("The graph is not bipartite");
+                    return false;
+                }
+            } else {
+                partie[z] = nextColor;
+            }
+
+            if (color[z] == Color::BLUE) {
+                color[z] = Color::WHITE;
+                parent[z] = w;
+                q.push(z);
+            }
+        }
+        color[w] = Color::RED;
+    }
+    return true;
+}
+
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, std::vector<T>>> Csr::Graph<T, W, D>::path(T from, T to) const {
+    Logger::debug("Path algorithm starting...");
+    if (from < 0 || from > this->size() - 1 || to < 0 || to > this->size() - 1) {
+        throw std::invalid_argument("int param have to be between 0 and the _size of the graph");
+    }
+
+    std::vector<T> parent = std::vector<T>(this->size(), -1);
+    std::vector<D> distance = std::vector<D>(this->size(), -1);
+
+    this->distanceFromSourceVisit(from, parent, distance, to);
+
+    if (distance[to] == -1) {
+        return std::nullopt;
+    }
+
+    Logger::debug("Path found !");
+    std::pair<D, std::vector<T>> path = {distance[to], {}};
+    for (T tmp = to; tmp != T(-1); tmp = parent[tmp]) {
+        path.second.push_back(tmp);
+    }
+    std::reverse(path.second.begin(), path.second.end());
+
+    return path;
+}
+
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, T>> Csr::Graph<T, W, D>::eccentricity(T v) const {
+    std::optional<std::pair<D, T>> res;
+
+    std::vector<D> dist = this->distanceFrom(v);
+
+    for (T i = 0; i < this->size(); i++) {
+        if (dist[i] > -1 && (!res.has_value() || res.value().first < dist[i]) && i != v) {
+            res = {dist[i], i};
+        }
+    }
+
+    return res;
+}
+
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, std::pair<T, T>>> Csr::Graph<T, W, D>::radius() const {
+    Logger::debug("Radius algorithm starting...");
+    return Eccentricity::boundingDiameters<T, D>(this->size(), this->_d == Type::UNDIRECTED, false, [this](T v, TraversalWorkspace<T, D> &workspace) {
+        this->distanceFromSourceVisit(v, workspace);
+    });
+}
+
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, std::pair<T, T>>> Csr::Graph<T, W, D>::diameter() const {
+    Logger::debug("Diameter algorithm starting...");
+    return Eccentricity::boundingDiameters<T, D>(this->size(), this->_d == Type::UNDIRECTED, true, [this](T v, TraversalWorkspace<T, D> &workspace) {
+        this->distanceFromSourceVisit(v, workspace);
+    });
+}
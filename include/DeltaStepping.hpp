@@ -0,0 +1,153 @@
+#pragma once
+
+#include "ThreadPool.hpp"
+
+#include <atomic>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ShortestPath {
+    /**
+     * @brief Bucket width for delta-stepping: the heaviest weight over the average degree (Meyer and Sanders),
+     * so a bucket holds about one edge length worth of vertices per neighbour
+     * @param vertices -> number of vertices
+     * @param arcs -> number of stored arcs
+     * @param maxWeight -> the heaviest edge of the graph
+     */
+    template<typename T>
+    T autoDelta(size_t vertices, size_t arcs, T maxWeight) {
+        if (arcs == 0 || maxWeight <= 0) {
+            return 1;
+        }
+        // in double, the product overflows a 32 bits T on large graphs and a count of arcs may not fit in T
+        double delta = std::min(double(maxWeight) * double(vertices) / double(arcs), double(maxWeight));
+        if constexpr (std::is_integral_v<T>) {
+            return T(std::max(delta, 1.0));
+        } else {
+            return delta > 0 ? T(delta) : maxWeight;
+        }
+    }
+
+    /**
+     * @brief Parallel delta-stepping single source shortest paths
+     * vertices are kept in buckets of width delta, the light edges (weight <= delta) of the current bucket are relaxed
+     * in parallel until it stays empty, then the heavy edges of every vertex settled in it are relaxed once
+     * @param source -> the source
+     * @param vertices -> number of vertices
+     * @param minWeight -> the lightest edge of the graph (or 0), it must not be negative
+     * @param delta -> the bucket width
+     * @param pool -> the threads
+     * @param forEachEdge -> forEachEdge(w, f) calls f(z, weight) for every edge w -> z
+     * @return a vector of the distance from source, -1 if not reachable
+     * @tparam T the vertices, D the distances
+     */
+    template<typename T, typename D, typename ForEachEdge>
+    std::vector<D> deltaStepping(T source, size_t vertices, D minWeight, D delta, ThreadPool &pool, ForEachEdge forEachEdge) {
+        if (minWeight < 0) {
+            throw std::invalid_argument("Shortest paths need non negative weights");
+        }
+        if (!(delta > 0)) {
+            throw std::invalid_argument("delta must be positive");
+        }
+
+        constexpr D infinity = std::numeric_limits<D>::max();
+
+        std::vector<std::atomic<D>> distance(vertices);
+        for (auto &d : distance) {
+            d.store(infinity, std::memory_order_relaxed);
+        }
+
+        std::vector<std::vector<T>> buckets(1);
+        std::vector<std::vector<T>> local(pool.size());
+        std::vector<T> frontier;
+        std::vector<T> settled;
+
+        auto bucketOf = [delta](D d) {
+            return size_t(d / delta);
+        };
+
+        // relax(z, candidate) lowers distance[z] with a compare and swap and remembers z when it wins
+        auto relax = [&](size_t id, T z, D candidate) {
+            D current = distance[z].load(std::memory_order_relaxed);
+            while (candidate < current) {
+                if (distance[z].compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {
+                    local[id].push_back(z);
+                    return;
+                }
+            }
+        };
+
+        auto merge = [&]() {
+            for (std::vector<T> &requests : local) {
+                for (T z : requests) {
+                    size_t b = bucketOf(distance[z].load(std::memory_order_relaxed));
+                    if (b >= buckets.size()) {
+                        buckets.resize(b + 1);
+                    }
+                    buckets[b].push_back(z);
+                }
+                requests.clear();
+            }
+        };
+
+        auto relaxEdges = [&](const std::vector<T> &from, bool light) {
+            pool.parallelFor(from.size(), [&](size_t id, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++) {
+                    T w = from[i];
+                    D d = distance[w].load(std::memory_order_relaxed);
+                    forEachEdge(w, [&](T z, D weight) {
+                        if ((weight <= delta) == light) {
+                            relax(id, z, d + weight);
+                        }
+                    });
+                }
+            });
+            merge();
+        };
+
+        distance[source].store(0, std::memory_order_relaxed);
+        buckets[0].push_back(source);
+
+        // queued[v] == i + 1 once v is in the frontier of bucket i, settledIn[v] == i + 1 once it is in its settled set
+        std::vector<size_t> queued(vertices, 0);
+        std::vector<size_t> settledIn(vertices, 0);
+
+        for (size_t i = 0; i < buckets.size(); i++) {
+            settled.clear();
+            while (!buckets[i].empty()) {
+                frontier.clear();
+                std::swap(frontier, buckets[i]);
+
+                // a vertex may have been pushed more than once or moved to a lower bucket since
+                std::erase_if(frontier, [&](T w) {
+                    if (queued[w] == i + 1 || bucketOf(distance[w].load(std::memory_order_relaxed)) != i) {
+                        return true;
+                    }
+                    queued[w] = i + 1;
+                    return false;
+                });
+
+                for (T w : frontier) {
+                    queued[w] = 0;
+                    if (settledIn[w] != i + 1) {
+                        settledIn[w] = i + 1;
+                        settled.push_back(w);
+                    }
+                }
+                relaxEdges(frontier, true);
+            }
+
+            relaxEdges(settled, false);
+        }
+
+        std::vector<D> res(vertices);
+        for (size_t v = 0; v < vertices; v++) {
+            D d = distance[v].load(std::memory_order_relaxed);
+            res[v] = d == infinity ? D(-1) : d;
+        }
+        return res;
+    }
+}
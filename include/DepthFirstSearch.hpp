@@ -0,0 +1,261 @@
+#pragma once
+
+#include "Utils.hpp"
+
+#include <vector>
+#include <utility>
+
+namespace DepthFirst {
+    /**
+     * @brief Hooks called by the DFS engine, a visitor inherits from it and hides the ones it needs
+     * setting stopped ends the search, the vertices still on the stack are left WHITE
+     */
+    template<typename T>
+    struct Visitor {
+        bool stopped = false;
+
+        /**
+         * @brief v is reached for the first time, from parent (-1 for a root)
+         */
+        void discover(T /*v*/, T /*parent*/) {}
+
+        /**
+         * @brief every edge of v has been explored
+         */
+        void finish(T /*v*/) {}
+
+        /**
+         * @brief edge v -> z towards an already reached vertex, WHITE if z is an ancestor of v (still on the stack), RED otherwise
+         */
+        void nonTreeEdge(T /*v*/, T /*z*/, Color /*color*/) {}
+    };
+
+    /**
+     * @brief Result of a full DFS
+     * discovery and finish share one clock, so v is an ancestor of w iff discovery[v] < discovery[w] < finish[w] < finish[v]
+     */
+    template<typename T>
+    struct Tree {
+        std::vector<T> preorder;
+        std::vector<T> postorder;
+        std::vector<T> parent;
+        std::vector<size_t> discovery;
+        std::vector<size_t> finish;
+    };
+
+    /**
+     * @brief Colors of the vertices kept in a vector, every vertex starts BLUE
+     */
+    template<typename T>
+    struct Colors {
+        std::vector<Color> colors;
+
+        explicit Colors(size_t vertices) : colors(vertices, Color::BLUE) {}
+
+        [[nodiscard]] Color color(T v) const {
+            return this->colors[size_t(v)];
+        }
+
+        void paint(T v, Color color) {
+            this->colors[size_t(v)] = color;
+        }
+    };
+
+    /**
+     * @brief Iterative DFS from root, a frame of the stack is (vertex, index of its next edge)
+     * so the memory is O(depth) frames on the heap and deep graphs cannot overflow the call stack
+     * @param root -> the root, it must be BLUE
+     * @param colors -> color(v) and paint(v, color), BLUE not reached, WHITE on the stack, RED finished, see Colors
+     * @param stack -> an empty stack, given so its memory is reused between roots
+     * @param nextNeighbour -> nextNeighbour(v, next, z) sets z to the first neighbour of v from edge index next, moves next after it and returns false when there is none left
+     * @param visitor -> the hooks
+     */
+    template<typename T, typename C, typename NextNeighbour, typename V>
+    void visit(T root, C &colors, std::vector<std::pair<T, size_t>> &stack, NextNeighbour &nextNeighbour, V &visitor) {
+        colors.paint(root, Color::WHITE);
+        visitor.discover(root, T(-1));
+        stack.emplace_back(root, 0);
+
+        while (!stack.empty() && !visitor.stopped) {
+            T v = stack.back().first;
+            T z;
+            if (nextNeighbour(v, stack.back().second, z)) {
+                Color color = colors.color(z);
+                if (color == Color::BLUE) {
+                    colors.paint(z, Color::WHITE);
+                    visitor.discover(z, v);
+                    stack.emplace_back(z, 0);
+                } else {
+                    visitor.nonTreeEdge(v, z, color);
+                }
+            } else {
+                colors.paint(v, Color::RED);
+                stack.pop_back();
+                visitor.finish(v);
+            }
+        }
+
+        stack.clear();
+    }
+
+    /**
+     * @brief DFS from start, then from every vertex not reached yet in increasing order
+     * @param vertices -> number of vertices
+     * @param start -> the first root
+     * @param colors -> every vertex BLUE, see visit
+     * @param stack -> an empty stack
+     */
+    template<typename T, typename C, typename NextNeighbour, typename V>
+    void forest(size_t vertices, T start, C &colors, std::vector<std::pair<T, size_t>> &stack, NextNeighbour nextNeighbour, V &visitor) {
+        if (vertices == 0) {
+            return;
+        }
+
+        visit(start, colors, stack, nextNeighbour, visitor);
+        for (size_t v = 0; v < vertices && !visitor.stopped; v++) {
+            if (colors.color(T(v)) == Color::BLUE) {
+                visit(T(v), colors, stack, nextNeighbour, visitor);
+            }
+        }
+    }
+
+    /**
+     * @brief DFS from start, then from every vertex not reached yet in increasing order
+     * @param vertices -> number of vertices
+     * @param start -> the first root
+     */
+    template<typename T, typename NextNeighbour, typename V>
+    void forest(size_t vertices, T start, NextNeighbour nextNeighbour, V &visitor) {
+        Colors<T> colors(vertices);
+        std::vector<std::pair<T, size_t>> stack;
+        forest(vertices, start, colors, stack, nextNeighbour, visitor);
+    }
+
+    template<typename T>
+    struct TreeVisitor : Visitor<T> {
+        Tree<T> tree;
+        size_t clock = 0;
+
+        explicit TreeVisitor(size_t vertices) {
+            this->tree.parent.assign(vertices, -1);
+            this->tree.discovery.assign(vertices, 0);
+            this->tree.finish.assign(vertices, 0);
+            this->tree.preorder.reserve(vertices);
+            this->tree.postorder.reserve(vertices);
+        }
+
+        void discover(T v, T parent) {
+            this->tree.parent[size_t(v)] = parent;
+            this->tree.discovery[size_t(v)] = this->clock++;
+            this->tree.preorder.push_back(v);
+        }
+
+        void finish(T v) {
+            this->tree.finish[size_t(v)] = this->clock++;
+            this->tree.postorder.push_back(v);
+        }
+    };
+
+    /**
+     * @brief Lists the vertices in preorder or postorder, and remembers if an edge went back to an ancestor
+     */
+    template<typename T>
+    struct OrderVisitor : Visitor<T> {
+        std::vector<T> res;
+        Type::Print type;
+        bool backEdge = false;
+
+        explicit OrderVisitor(Type::Print type) : type(type) {}
+
+        void discover(T v, T /*parent*/) {
+            if (this->type == Type::Print::PREORDER) {
+                this->res.push_back(v);
+            }
+        }
+
+        void finish(T v) {
+            if (this->type == Type::Print::POSTORDER) {
+                this->res.push_back(v);
+            }
+        }
+
+        void nonTreeEdge(T /*v*/, T /*z*/, Color color) {
+            if (color == Color::WHITE) {
+                this->backEdge = true;
+            }
+        }
+    };
+
+    /**
+     * @brief Keeps the vertices from the root to the vertex on top of the stack, stops once target is reached
+     */
+    template<typename T>
+    struct PathVisitor : Visitor<T> {
+        std::vector<T> path;
+        T target;
+
+        explicit PathVisitor(T target = -1) : target(target) {}
+
+        void discover(T v, T /*parent*/) {
+            this->path.push_back(v);
+            if (v == this->target) {
+                this->stopped = true;
+            }
+        }
+
+        void finish(T /*v*/) {
+            this->path.pop_back();
+        }
+    };
+
+    /**
+     * @brief Stops on the first edge closing a cycle, O(n + m)
+     * directed graph: an edge back to a vertex still on the stack
+     * undirected graph: an edge to a vertex still on the stack, except the tree edge to the parent which is skipped once
+     * (so parallel edges and self loops are cycles)
+     * cycle then holds the vertices of the cycle, the first one repeated at the end
+     */
+    template<typename T>
+    struct CycleVisitor : PathVisitor<T> {
+        bool directed;
+        std::vector<T> parent;
+        std::vector<size_t> position;
+        std::vector<bool> parentSkipped;
+        std::vector<T> cycle;
+
+        CycleVisitor(size_t vertices, bool directed) : directed(directed), parent(vertices, -1), position(vertices, 0), parentSkipped(vertices, false) {}
+
+        void discover(T v, T parent) {
+            this->parent[size_t(v)] = parent;
+            this->position[size_t(v)] = this->path.size();
+            PathVisitor<T>::discover(v, parent);
+        }
+
+        void nonTreeEdge(T v, T z, Color color) {
+            if (color != Color::WHITE) {
+                return;
+            }
+            if (!this->directed && z == this->parent[size_t(v)] && !this->parentSkipped[size_t(v)]) {
+                this->parentSkipped[size_t(v)] = true;
+                return;
+            }
+
+            this->cycle.assign(this->path.begin() + this->position[size_t(z)], this->path.end());
+            this->cycle.push_back(z);
+            this->stopped = true;
+        }
+    };
+
+    /**
+     * @brief Full DFS with its orders, parents and times
+     * @param vertices -> number of vertices
+     * @param start -> the first root
+     * @param nextNeighbour -> see visit
+     */
+    template<typename T, typename NextNeighbour>
+    Tree<T> tree(size_t vertices, T start, NextNeighbour nextNeighbour) {
+        TreeVisitor<T> visitor(vertices);
+        forest(vertices, start, nextNeighbour, visitor);
+        return std::move(visitor.tree);
+    }
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Logger.hpp"
+#include "TraversalWorkspace.hpp"
+
+#include <vector>
+#include <limits>
+#include <utility>
+#include <optional>
+#include <algorithm>
+
+namespace Eccentricity {
+    /**
+     * @brief Farthest vertex reached by the last run of a workspace, the smallest one on ties
+     * @param v -> the source of the run, it is not counted
+     * @return std::pair(distance, vertex), nothing if v reached no other vertex
+     */
+    template<typename T, typename D>
+    std::optional<std::pair<D, T>> farthest(T v, const TraversalWorkspace<T, D> &workspace) {
+        std::optional<std::pair<D, T>> res;
+        for (T w : workspace.order()) {
+            D d = workspace.distance(w);
+            if (w != v && (!res.has_value() || res.value().first < d || (res.value().first == d && w < res.value().second))) {
+                res = {d, w};
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @brief Exact radius or diameter with eccentricity bounds (Takes and Kosters, BoundingDiameters)
+     * after a traversal from v, every w reached at distance d satisfies max(d, ecc(v) - d) <= ecc(w) <= ecc(v) + d,
+     * a vertex whose bounds cannot beat the best exact eccentricity anymore is pruned without being traversed
+     * the bounds only hold when d(v, w) == d(w, v), a directed graph traverses every vertex
+     * ties keep the smallest vertex and its first farthest vertex, like a loop over every eccentricity
+     * @param vertices -> number of vertices
+     * @param undirected -> true if the distances are symmetric
+     * @param maximum -> true for the diameter, false for the radius
+     * @param distanceFrom -> distanceFrom(v, workspace) runs the distances from v in workspace, one workspace serves every traversal
+     * @return std::pair(distance, std::pair(from, to))
+     * @tparam T the vertices, D the distances
+     */
+    template<typename T, typename D = T, typename DistanceFrom>
+    std::optional<std::pair<D, std::pair<T, T>>> boundingDiameters(size_t vertices, bool undirected, bool maximum, DistanceFrom distanceFrom) {
+        std::optional<std::pair<D, std::pair<T, T>>> best;
+
+        std::vector<D> lower(vertices, 0);
+        std::vector<D> upper(vertices, std::numeric_limits<D>::max());
+        TraversalWorkspace<T, D> workspace(vertices);
+        std::vector<T> candidates(vertices);
+        for (size_t i = 0; i < vertices; i++) {
+            candidates[i] = T(i);
+        }
+
+        // true if the eccentricity of w can still replace the best one
+        auto canImprove = [&](T w) {
+            if (!best.has_value()) {
+                return true;
+            }
+            D ecc = best.value().first;
+            D bound = maximum ? upper[size_t(w)] : lower[size_t(w)];
+            if (bound == ecc) {
+                return w < best.value().second.first;
+            }
+            return maximum ? bound > ecc : bound < ecc;
+        };
+
+        size_t traversals = 0;
+        while (!candidates.empty()) {
+            // alternate between the vertices with the largest upper bound and the smallest lower bound
+            bool periphery = traversals % 2 == (maximum ? 0 : 1);
+            T v = *std::ranges::min_element(candidates, [&](T a, T b) {
+                return periphery ? upper[size_t(a)] > upper[size_t(b)] : lower[size_t(a)] < lower[size_t(b)];
+            });
+
+            distanceFrom(v, workspace);
+            traversals++;
+
+            std::optional<std::pair<D, T>> ecc = farthest(v, workspace);
+
+            if (ecc.has_value()) {
+                lower[size_t(v)] = upper[size_t(v)] = ecc.value().first;
+                if (canImprove(v)) {
+                    best = {ecc.value().first, {v, ecc.value().second}};
+                }
+
+                if (undirected) {
+                    for (T w : candidates) {
+                        D d = workspace.distance(w);
+                        if (d > -1 && w != v) {
+                            lower[size_t(w)] = std::max({lower[size_t(w)], d, ecc.value().first - d});
+                            upper[size_t(w)] = std::min(upper[size_t(w)], ecc.value().first + d);
+                        }
+                    }
+                }
+            }
+
+            std::erase_if(candidates, [&](T w) {
+                return w == v || !canImprove(w);
+            });
+        }
+
+        Logger::debug("Bounding diameters : " + std::to_string(traversals) + " traversals, " + std::to_string(vertices - traversals) + " pruned");
+
+        return best;
+    }
+}
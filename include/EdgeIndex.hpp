@@ -0,0 +1,167 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+namespace List {
+    /**
+     * @brief Open addressing hash table from an arc (from, to) to the position of one of its copies in the adjacency list of from
+     * and its number of copies, so parallel arcs stay in the lists
+     * linear probing on the packed key, deletions shift the next entries back so no tombstone is left behind
+     * ids of up to 32 bits share one 64 bits key, wider ids take a key of two words so no two arcs collide
+     */
+    template<typename T>
+    class EdgeIndex {
+    public:
+        struct Entry {
+            size_t position;
+            size_t count;
+        };
+
+    private:
+        using Key = std::conditional_t<sizeof(T) <= 4, uint64_t, std::pair<uint64_t, uint64_t>>;
+
+        static constexpr Key emptyKey = [] {
+            if constexpr (sizeof(T) <= 4) {
+                return ~uint64_t(0);
+            } else {
+                return Key(~uint64_t(0), ~uint64_t(0));
+            }
+        }();
+
+        std::vector<Key> keys;
+        std::vector<Entry> entries;
+        size_t count = 0;
+
+        static Key pack(T from, T to) {
+            if constexpr (sizeof(T) <= 4) {
+                return uint64_t(uint32_t(size_t(from))) << 32 | uint32_t(size_t(to));
+            } else {
+                return Key(uint64_t(from), uint64_t(to));
+            }
+        }
+
+        // finalizer of MurmurHash3, the packed keys of a vertex only differ by their low bits
+        static uint64_t mix(uint64_t key) {
+            key ^= key >> 33;
+            key *= 0xff51afd7ed558ccdULL;
+            key ^= key >> 33;
+            key *= 0xc4ceb9fe1a85ec53ULL;
+            key ^= key >> 33;
+            return key;
+        }
+
+        static uint64_t hash(Key key) {
+            if constexpr (sizeof(T) <= 4) {
+                return mix(key);
+            } else {
+                return mix(mix(key.first) ^ key.second);
+            }
+        }
+
+        [[nodiscard]] size_t mask() const {
+            return this->keys.size() - 1;
+        }
+
+        [[nodiscard]] size_t slot(Key key) const {
+            size_t i = hash(key) & this->mask();
+            while (this->keys[i] != emptyKey && this->keys[i] != key) {
+                i = (i + 1) & this->mask();
+            }
+            return i;
+        }
+
+        void grow() {
+            std::vector<Key> oldKeys(this->keys.size() * 2, emptyKey);
+            std::vector<Entry> oldEntries(this->keys.size() * 2);
+            std::swap(oldKeys, this->keys);
+            std::swap(oldEntries, this->entries);
+
+            for (size_t i = 0; i < oldKeys.size(); i++) {
+                if (oldKeys[i] != emptyKey) {
+                    size_t j = this->slot(oldKeys[i]);
+                    this->keys[j] = oldKeys[i];
+                    this->entries[j] = oldEntries[i];
+                }
+            }
+        }
+
+    public:
+        /**
+         * @param capacity -> expected number of arcs
+         */
+        explicit EdgeIndex(size_t capacity = 0) {
+            size_t slots = 16;
+            while (slots * 7 < capacity * 10) {
+                slots *= 2;
+            }
+            this->keys.assign(slots, emptyKey);
+            this->entries.resize(slots);
+        }
+
+        [[nodiscard]] size_t size() const {
+            return this->count;
+        }
+
+        /**
+         * @brief Position of a copy of the arc in the adjacency list of from and number of copies
+         * @return a pointer to the entry, nullptr if the arc is not indexed
+         */
+        [[nodiscard]] const Entry *find(T from, T to) const {
+            size_t i = this->slot(pack(from, to));
+            return this->keys[i] == emptyKey ? nullptr : &this->entries[i];
+        }
+
+        [[nodiscard]] Entry *find(T from, T to) {
+            size_t i = this->slot(pack(from, to));
+            return this->keys[i] == emptyKey ? nullptr : &this->entries[i];
+        }
+
+        /**
+         * @brief Index a new copy of an arc, the position is kept if the arc already has one
+         * @param position -> position of the new copy in the adjacency list of from
+         */
+        void add(T from, T to, size_t position) {
+            if ((this->count + 1) * 10 > this->keys.size() * 7) {
+                this->grow();
+            }
+
+            Key key = pack(from, to);
+            size_t i = this->slot(key);
+            if (this->keys[i] == emptyKey) {
+                this->keys[i] = key;
+                this->entries[i] = {position, 0};
+                this->count++;
+            }
+            this->entries[i].count++;
+        }
+
+        /**
+         * @brief Remove an arc and all its copies from the index
+         * @return true if the arc was indexed
+         */
+        bool erase(T from, T to) {
+            size_t i = this->slot(pack(from, to));
+            if (this->keys[i] == emptyKey) {
+                return false;
+            }
+
+            // move back every entry of the probe sequence that would not be found anymore
+            for (size_t j = (i + 1) & this->mask(); this->keys[j] != emptyKey; j = (j + 1) & this->mask()) {
+                size_t home = hash(this->keys[j]) & this->mask();
+                bool stays = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+                if (!stays) {
+                    this->keys[i] = this->keys[j];
+                    this->entries[i] = this->entries[j];
+                    i = j;
+                }
+            }
+
+            this->keys[i] = emptyKey;
+            this->count--;
+            return true;
+        }
+    };
+}
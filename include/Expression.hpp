@@ -0,0 +1,206 @@
+#pragma once
+
+#include "Constants.hpp"
+
+#include <string>
+#include <cstddef>
+#include <utility>
+#include <concepts>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+
+namespace Matrix {
+    template<typename T>
+    class M;
+
+    /**
+     * @brief Lazy element-wise arithmetic on M, A + B - C * 2 builds a tree of small nodes and allocates nothing,
+     * assigning the tree to an M computes every cell in a single pass over the operands
+     * a node reads the cells of its matrices, so it must not outlive them, keep it in an M rather than in an auto
+     */
+    namespace Expression {
+        /**
+         * @brief A rows x cols value whose cell i (row-major) is e[i]
+         */
+        template<typename E>
+        concept Node = requires(const E &e, size_t i) {
+            typename E::value_type;
+            { e.rows() } -> std::convertible_to<size_t>;
+            { e.cols() } -> std::convertible_to<size_t>;
+            { e[i] } -> std::convertible_to<typename E::value_type>;
+        };
+
+        template<typename E>
+        struct IsMatrix : std::false_type {};
+
+        template<typename T>
+        struct IsMatrix<M<T>> : std::true_type {};
+
+        /**
+         * @brief What the operators accept, a matrix or a node
+         */
+        template<typename E>
+        concept Operand = Node<E> || IsMatrix<E>::value;
+
+        /**
+         * @brief Leaf of the tree, the cells of a matrix
+         */
+        template<typename T>
+        class Ref {
+        private:
+            const T *_data;
+            size_t _rows;
+            size_t _cols;
+
+        public:
+            using value_type = T;
+
+            explicit Ref(const M<T> &matrix) : _data(matrix.data()), _rows(matrix.size().row), _cols(matrix.size().col) {}
+
+            size_t rows() const { return _rows; }
+
+            size_t cols() const { return _cols; }
+
+            T operator[](size_t i) const { return _data[i]; }
+        };
+
+        /**
+         * @brief Op(lhs[i], rhs[i]) on two operands of the same size
+         */
+        template<typename L, typename R, typename Op>
+        class Binary {
+        private:
+            L _lhs;
+            R _rhs;
+
+        public:
+            using value_type = typename L::value_type;
+
+            /**
+             * @param name -> the operator, for the message of the exception
+             */
+            Binary(const L &lhs, const R &rhs, const char *name) : _lhs(lhs), _rhs(rhs) {
+                if (lhs.rows() != rhs.rows() || lhs.cols() != rhs.cols()) {
+                    throw std::invalid_argument(std::string("Matrix::") + name + "() -- incompatible sizes !");
+                }
+            }
+
+            size_t rows() const { return _lhs.rows(); }
+
+            size_t cols() const { return _lhs.cols(); }
+
+            value_type operator[](size_t i) const { return Op()(_lhs[i], _rhs[i]); }
+        };
+
+        /**
+         * @brief Op(node[i], value) for a scalar value
+         */
+        template<typename E, typename Op>
+        class Scalar {
+        private:
+            E _node;
+            typename E::value_type _value;
+
+        public:
+            using value_type = typename E::value_type;
+
+            Scalar(const E &node, value_type value) : _node(node), _value(value) {}
+
+            size_t rows() const { return _node.rows(); }
+
+            size_t cols() const { return _node.cols(); }
+
+            value_type operator[](size_t i) const { return Op()(_node[i], _value); }
+        };
+
+        template<typename T>
+        Ref<T> node(const M<T> &matrix) {
+            return Ref<T>(matrix);
+        }
+
+        template<Node E>
+        const E &node(const E &expression) {
+            return expression;
+        }
+
+        template<Operand E>
+        using NodeOf = std::decay_t<decltype(node(std::declval<const E &>()))>;
+
+        template<Operand E>
+        using ValueOf = typename NodeOf<E>::value_type;
+
+        /**
+         * @brief out = expression, the cells are computed by chunks of 16 into registers before they are stored,
+         * so out may be one of the operands and the chunks are vectorized without a scalar epilogue
+         * @param out -> expression.rows() * expression.cols() cells
+         */
+        template<Node E>
+        GGRAPH_SIMD_CLONES
+        void evaluate(const E &expression, typename E::value_type *out) {
+            using T = typename E::value_type;
+            size_t count = expression.rows() * expression.cols();
+            size_t i = 0;
+            for (; i + 16 <= count; i += 16) {
+                T chunk[16];
+                for (size_t u = 0; u < 16; u++) {
+                    chunk[u] = expression[i + u];
+                }
+                for (size_t u = 0; u < 16; u++) {
+                    out[i + u] = chunk[u];
+                }
+            }
+            for (; i < count; i++) {
+                out[i] = expression[i];
+            }
+        }
+
+        template<Operand L, Operand R>
+        requires std::same_as<ValueOf<L>, ValueOf<R>>
+        Binary<NodeOf<L>, NodeOf<R>, std::plus<ValueOf<L>>> operator+(const L &lhs, const R &rhs) {
+            return {node(lhs), node(rhs), "operator+"};
+        }
+
+        template<Operand L, Operand R>
+        requires std::same_as<ValueOf<L>, ValueOf<R>>
+        Binary<NodeOf<L>, NodeOf<R>, std::minus<ValueOf<L>>> operator-(const L &lhs, const R &rhs) {
+            return {node(lhs), node(rhs), "operator-"};
+        }
+
+        template<Operand E>
+        Scalar<NodeOf<E>, std::multiplies<ValueOf<E>>> operator*(const E &expression, ValueOf<E> value) {
+            return {node(expression), value};
+        }
+
+        template<Operand E>
+        Scalar<NodeOf<E>, std::multiplies<ValueOf<E>>> operator*(ValueOf<E> value, const E &expression) {
+            return {node(expression), value};
+        }
+
+        template<Operand E>
+        Scalar<NodeOf<E>, std::divides<ValueOf<E>>> operator/(const E &expression, ValueOf<E> value) {
+            return {node(expression), value};
+        }
+
+        /**
+         * @brief Matrix product with a node on one side at least, the node is evaluated into a matrix first
+         * and the product is computed eagerly by the blocked kernel
+         */
+        template<Operand L, Operand R>
+        requires (Node<L> || Node<R>) && std::same_as<ValueOf<L>, ValueOf<R>>
+        M<ValueOf<L>> operator*(const L &lhs, const R &rhs) {
+            if constexpr (Node<L> && Node<R>) {
+                return M<ValueOf<L>>(lhs) * M<ValueOf<R>>(rhs);
+            } else if constexpr (Node<L>) {
+                return M<ValueOf<L>>(lhs) * rhs;
+            } else {
+                return lhs * M<ValueOf<R>>(rhs);
+            }
+        }
+    }
+
+    using Expression::operator+;
+    using Expression::operator-;
+    using Expression::operator*;
+    using Expression::operator/;
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "Constants.hpp"
+#include "Semiring.hpp"
+#include "ThreadPool.hpp"
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+namespace FloydWarshall {
+    /**
+     * @brief Side of a tile, a tile of int or double and the two tiles it reads stay in L1 / L2
+     */
+    constexpr size_t B = 64;
+
+    /**
+     * @brief a + b that may overflow without undefined behaviour, so it can be computed before the select that discards it
+     */
+    template<typename T>
+    inline T wrappingAdd(T a, T b) {
+        if constexpr (std::is_integral_v<T>) {
+            using U = std::make_unsigned_t<T>;
+            return T(U(a) + U(b));
+        } else {
+            return a + b;
+        }
+    }
+
+    /**
+     * @brief row = min(row, toK + through) for a finite toK, selects keep the loop branch free
+     */
+    template<typename T>
+    inline void relaxRow(T *__restrict row, const T *__restrict through, T toK, size_t count) {
+        using MinPlus = Semiring::MinPlus<T>;
+        for (size_t j = 0; j < count; j++) {
+            T candidate = through[j] == MinPlus::zero() ? MinPlus::zero() : wrappingAdd(toK, through[j]);
+            row[j] = std::min(row[j], candidate);
+        }
+    }
+
+    /**
+     * @brief relaxRow that also sets the next hop of the improved cells to hop
+     */
+    template<typename T>
+    inline void relaxRow(T *__restrict row, T *__restrict nextRow, const T *__restrict through, T toK, T hop, size_t count) {
+        using MinPlus = Semiring::MinPlus<T>;
+        for (size_t j = 0; j < count; j++) {
+            T candidate = through[j] == MinPlus::zero() ? MinPlus::zero() : wrappingAdd(toK, through[j]);
+            T current = row[j];
+            T currentHop = nextRow[j];
+            nextRow[j] = candidate < current ? hop : currentHop;
+            row[j] = candidate < current ? candidate : current;
+        }
+    }
+
+    /**
+     * @brief Relax the tile (ib, jb) through the intermediate vertices of the tile column kb
+     * dist(i, j) = min(dist(i, j), dist(i, k) + dist(k, j)), the rows are relaxed with vectorized min-plus loops
+     * @param next -> the next hop matrix, nullptr if it is not needed
+     */
+    template<typename T>
+    GGRAPH_SIMD_CLONES
+    void relaxTile(T *dist, T *next, size_t n, size_t ib, size_t jb, size_t kb) {
+        size_t iEnd = std::min(ib + B, n);
+        size_t kEnd = std::min(kb + B, n);
+        // a constant count lets the compiler vectorize the full tiles without a scalar epilogue
+        size_t count = std::min(B, n - jb);
+
+        for (size_t k = kb; k < kEnd; k++) {
+            for (size_t i = ib; i < iEnd; i++) {
+                // the row k is left as is by k when there is no negative cycle, skipping it keeps the rows disjoint
+                T toK = dist[i * n + k];
+                if (toK == Semiring::MinPlus<T>::zero() || i == k) {
+                    continue;
+                }
+
+                T *row = dist + i * n + jb;
+                const T *through = dist + k * n + jb;
+                if (next == nullptr) {
+                    if (count == B) {
+                        relaxRow(row, through, toK, B);
+                    } else {
+                        relaxRow(row, through, toK, count);
+                    }
+                } else {
+                    if (count == B) {
+                        relaxRow(row, next + i * n + jb, through, toK, next[i * n + k], B);
+                    } else {
+                        relaxRow(row, next + i * n + jb, through, toK, next[i * n + k], count);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Blocked Floyd-Warshall in place, for every tile column kb:
+     * 1. the diagonal tile (kb, kb) on itself
+     * 2. the tiles of row kb and of column kb from the diagonal one, in parallel
+     * 3. every other tile from its tiles in row kb and column kb, in parallel
+     * a phase only reads tiles that are final for kb, so the tiles of a phase are independent
+     * @param dist -> n x n row-major, MinPlus zero for no edge and 0 on the diagonal, overwritten with the distances
+     * @param next -> n x n row-major next hops (j for an edge i -> j, i on the diagonal), nullptr if it is not needed
+     * @param pool -> the threads sharing the tiles of a phase
+     */
+    template<typename T>
+    void blocked(T *dist, T *next, size_t n, ThreadPool &pool) {
+        size_t tiles = (n + B - 1) / B;
+
+        for (size_t t = 0; t < tiles; t++) {
+            size_t kb = t * B;
+            relaxTile(dist, next, n, kb, kb, kb);
+
+            pool.parallelFor(2 * (tiles - 1), [&](size_t /*id*/, size_t begin, size_t end) {
+                for (size_t x = begin; x < end; x++) {
+                    size_t other = x / 2 < t ? x / 2 : x / 2 + 1;
+                    if (x % 2 == 0) {
+                        relaxTile(dist, next, n, kb, other * B, kb);
+                    } else {
+                        relaxTile(dist, next, n, other * B, kb, kb);
+                    }
+                }
+            }, 1);
+
+            pool.parallelFor((tiles - 1) * (tiles - 1), [&](size_t /*id*/, size_t begin, size_t end) {
+                for (size_t x = begin; x < end; x++) {
+                    size_t i = x / (tiles - 1);
+                    size_t j = x % (tiles - 1);
+                    i = i < t ? i : i + 1;
+                    j = j < t ? j : j + 1;
+                    relaxTile(dist, next, n, i * B, j * B, kb);
+                }
+            }, 1);
+        }
+    }
+}
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "Constants.hpp"
+#include "Semiring.hpp"
+#include "ThreadPool.hpp"
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+namespace Gemm {
+    /**
+     * @brief Rows of the register tile
+     */
+    constexpr size_t MR = 4;
+
+    /**
+     * @brief Columns of the register tile, two 512 bits vectors of T
+     */
+    template<typename T>
+    constexpr size_t NR = std::max<size_t>(4, 128 / sizeof(T));
+
+    /**
+     * @brief Depth of a packed panel, a strip of B (KC x NR) stays in L1
+     */
+    constexpr size_t KC = 256;
+
+    /**
+     * @brief Rows of a packed panel of A (MC x KC), it stays in L2
+     */
+    constexpr size_t MC = 128;
+
+    /**
+     * @brief Columns of a packed panel of B (KC x NC), it stays in L3
+     */
+    constexpr size_t NC = 1024;
+
+    /**
+     * @brief Textbook i-j-k product, kept as the reference of the tests and the benchmarks
+     * @tparam S -> the semiring, see Semiring.hpp
+     * @param a -> rows x inner, row-major
+     * @param b -> inner x cols, row-major
+     * @param c -> rows x cols, row-major, overwritten
+     */
+    template<typename T, typename S = Semiring::Plus<T>>
+    void naive(const T *a, const T *b, T *c, size_t rows, size_t inner, size_t cols) {
+        for (size_t i = 0; i < rows; i++) {
+            for (size_t j = 0; j < cols; j++) {
+                T sum = S::zero();
+                for (size_t k = 0; k < inner; k++) {
+                    sum = S::add(sum, S::mul(a[i * inner + k], b[k * cols + j]));
+                }
+                c[i * cols + j] = sum;
+            }
+        }
+    }
+
+    /**
+     * @brief Copy a kc x mc block of A into strips of MR rows, a strip is stored column by column
+     * the last strip is padded with the zero of the semiring
+     */
+    template<typename T, typename S>
+    void packA(const T *a, size_t lda, size_t mc, size_t kc, T *pack) {
+        for (size_t ir = 0; ir < mc; ir += MR) {
+            size_t rows = std::min(MR, mc - ir);
+            for (size_t p = 0; p < kc; p++) {
+                for (size_t i = 0; i < MR; i++) {
+                    *pack++ = i < rows ? a[(ir + i) * lda + p] : S::zero();
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Copy a kc x nc block of B into strips of NR columns, a strip is stored row by row
+     * the last strip is padded with the zero of the semiring
+     */
+    template<typename T, typename S>
+    void packB(const T *b, size_t ldb, size_t kc, size_t nc, T *pack) {
+        for (size_t jr = 0; jr < nc; jr += NR<T>) {
+            size_t cols = std::min(NR<T>, nc - jr);
+            for (size_t p = 0; p < kc; p++) {
+                const T *row = b + p * ldb + jr;
+                for (size_t j = 0; j < NR<T>; j++) {
+                    *pack++ = j < cols ? row[j] : S::zero();
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief C[MR x NR] += A strip * B strip, the accumulators live in registers and the j loop is vectorized
+     * @param rows -> rows of C to write back, at most MR
+     * @param cols -> cols of C to write back, at most NR
+     */
+    template<typename T, typename S>
+    GGRAPH_SIMD_CLONES
+    void microKernel(size_t kc, const T *a, const T *b, T *c, size_t ldc, size_t rows, size_t cols) {
+        T acc[MR][NR<T>];
+        for (size_t i = 0; i < MR; i++) {
+            for (size_t j = 0; j < NR<T>; j++) {
+                acc[i][j] = S::zero();
+            }
+        }
+        for (size_t p = 0; p < kc; p++) {
+            for (size_t i = 0; i < MR; i++) {
+                for (size_t j = 0; j < NR<T>; j++) {
+                    acc[i][j] = S::add(acc[i][j], S::mul(a[p * MR + i], b[p * NR<T> + j]));
+                }
+            }
+        }
+
+        if (rows == MR && cols == NR<T>) {
+            for (size_t i = 0; i < MR; i++) {
+                for (size_t j = 0; j < NR<T>; j++) {
+                    c[i * ldc + j] = S::add(c[i * ldc + j], acc[i][j]);
+                }
+            }
+        } else {
+            for (size_t i = 0; i < rows; i++) {
+                for (size_t j = 0; j < cols; j++) {
+                    c[i * ldc + j] = S::add(c[i * ldc + j], acc[i][j]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief C[ic.., jc..] (mc x nc) = A * B, the whole inner dimension is summed by the caller of this tile
+     * so every element is accumulated in the same order whichever thread computes it
+     */
+    template<typename T, typename S>
+    void tile(const T *a, size_t lda, const T *b, size_t ldb, T *c, size_t ldc, size_t inner,
+              size_t ic, size_t mc, size_t jc, size_t nc, std::vector<T> &aPack, std::vector<T> &bPack) {
+        for (size_t pc = 0; pc < inner; pc += KC) {
+            size_t kc = std::min(KC, inner - pc);
+            packB<T, S>(b + pc * ldb + jc, ldb, kc, nc, bPack.data());
+            packA<T, S>(a + ic * lda + pc, lda, mc, kc, aPack.data());
+
+            for (size_t jr = 0; jr < nc; jr += NR<T>) {
+                for (size_t ir = 0; ir < mc; ir += MR) {
+                    microKernel<T, S>(kc, aPack.data() + ir * kc, bPack.data() + jr * kc,
+                                c + (ic + ir) * ldc + jc + jr, ldc,
+                                std::min(MR, mc - ir), std::min(NR<T>, nc - jr));
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Blocked product C = A * B (Goto's loop order), panels of A and B are packed so the micro kernel reads contiguous memory
+     * the MC x NC tiles of C are independent, with a pool they are handed out to its threads,
+     * each tile sums the inner dimension in the same order so the result does not depend on the number of threads
+     * @param a -> rows x inner, row-major, a row starts lda elements after the previous one
+     * @param b -> inner x cols, row-major, a row starts ldb elements after the previous one
+     * @param c -> rows x cols, row-major, a row starts ldc elements after the previous one, overwritten
+     * @param pool -> the threads sharing the tiles, nullptr to run on the caller only
+     * @tparam S -> the semiring, see Semiring.hpp
+     */
+    template<typename T, typename S = Semiring::Plus<T>>
+    void multiply(const T *a, size_t lda, const T *b, size_t ldb, T *c, size_t ldc, size_t rows, size_t inner, size_t cols, ThreadPool *pool = nullptr) {
+        for (size_t i = 0; i < rows; i++) {
+            std::fill(c + i * ldc, c + i * ldc + cols, S::zero());
+        }
+        if (rows == 0 || inner == 0 || cols == 0) {
+            return;
+        }
+
+        size_t kcMax = std::min(KC, inner);
+        size_t mcMax = std::min(MC, rows);
+        size_t ncMax = std::min(NC, cols);
+        size_t rowTiles = (rows + MC - 1) / MC;
+        size_t tiles = rowTiles * ((cols + NC - 1) / NC);
+        size_t threads = pool == nullptr || tiles == 1 ? 1 : pool->size();
+
+        // one pair of packing buffers per thread, allocated by the thread on its first tile
+        std::vector<std::vector<T>> aPack(threads);
+        std::vector<std::vector<T>> bPack(threads);
+
+        auto body = [&](size_t id, size_t begin, size_t end) {
+            if (aPack[id].empty()) {
+                aPack[id].resize(kcMax * ((mcMax + MR - 1) / MR * MR));
+                bPack[id].resize(kcMax * ((ncMax + NR<T> - 1) / NR<T> * NR<T>));
+            }
+            for (size_t t = begin; t < end; t++) {
+                size_t ic = t % rowTiles * MC;
+                size_t jc = t / rowTiles * NC;
+                tile<T, S>(a, lda, b, ldb, c, ldc, inner, ic, std::min(MC, rows - ic), jc, std::min(NC, cols - jc), aPack[id], bPack[id]);
+            }
+        };
+
+        if (threads == 1) {
+            body(0, 0, tiles);
+        } else {
+            pool->parallelFor(tiles, body, 1);
+        }
+    }
+
+    /**
+     * @brief multiply on whole row-major matrices
+     */
+    template<typename T, typename S = Semiring::Plus<T>>
+    void multiply(const T *a, const T *b, T *c, size_t rows, size_t inner, size_t cols, ThreadPool *pool = nullptr) {
+        multiply<T, S>(a, inner, b, cols, c, cols, rows, inner, cols, pool);
+    }
+}
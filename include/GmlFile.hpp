@@ -38,13 +38,14 @@ void toGmlFile(const std::string& filename, const G& graph) {
         }
 
 
+        using std::to_string;
         for (int i = 0; i < graph.size(); i++) {
-            for (auto v : graph[i]) {
+            for (auto [target, weight] : graph[i]) {
                 outputFile << "edge\n[\n";
 
                 outputFile << "source " << std::to_string(i) << "\n";
-                outputFile << "target " << std::to_string(v.first) << "\n";
-                outputFile << "label " << "\"" << std::to_string(v.second) << "\"" << "\n";
+                outputFile << "target " << std::to_string(target) << "\n";
+                outputFile << "label " << "\"" << to_string(weight) << "\"" << "\n";
 
                 outputFile << "]\n";
             }
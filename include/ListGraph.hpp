@@ -2,6 +2,13 @@
 
 #include "Utils.hpp"
 #include "Logger.hpp"
+#include "ParallelBFS.hpp"
+#include "ShortestPath.hpp"
+#include "TraversalWorkspace.hpp"
+#include "Eccentricity.hpp"
+#include "DeltaStepping.hpp"
+#include "EdgeIndex.hpp"
+#include "DepthFirstSearch.hpp"
 
 #include <queue>
 #include <stack>
@@ -9,32 +16,70 @@
 #include <exception>
 #include <iostream>
 #include <random>
+#include <span>
+#include <memory>
+#include <memory_resource>
 
 namespace List {
-    template<typename T>
+    /**
+     * @tparam T the vertex ids
+     * @tparam W the weights of the edges, void for an unweighted graph whose arcs only store the neighbour
+     * @tparam D the distances, the weights by default, a signed number of edges for an unweighted graph
+     */
+    template<typename T, typename W = T, typename D = Type::DistanceOf<T, W>>
     class Graph {
+    public:
+        using Vertex = T;
+        using Weight = Type::WeightOf<W>;
+
+        /**
+         * @brief std::pair(neighbour, weight), or Type::UnweightedArc when W is void
+         */
+        using Arc = Type::ArcOf<T, W>;
+
+        /**
+         * @brief Neighbours of a vertex, allocated from the memory resource of the graph
+         */
+        using Adjacency = std::pmr::vector<Arc>;
+
     private:
-        std::vector<std::vector<std::pair<T, T>>> adjList;
+        // declared before the lists so it is destroyed after them
+        std::unique_ptr<std::pmr::monotonic_buffer_resource> _arena;
+        std::pmr::vector<Adjacency> adjList;
         size_t _size;
+        Weight _minWeight = 0;
+        Weight _maxWeight = 0;
+        std::optional<EdgeIndex<T>> _edgeIndex;
+
+        void addArc(T from, T to, Weight weight);
+
+        bool removeArc(T from, T to);
+
+        /**
+         * @brief Take the lists and the arena of graph, which is left with empty lists on the heap
+         * a pmr vector keeps its memory resource when it is assigned, so the lists are rebuilt around the one of graph
+         */
+        void takeStorage(Graph &graph) noexcept;
 
     protected:
         Type::Graph _d;
 
         void BFSVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &res);
 
-        void DFSVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &res, Type::Print type);
+        void BFSVisit(T v, TraversalWorkspace<T, D> &workspace);
 
-        void DFSVisitStack(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &res, Type::Print type);
+        void hybridBFSVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &res, std::vector<Type::Direction> &levels, const std::pmr::vector<Adjacency> &incoming, size_t &unexploredEdges);
 
-        bool cycleVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &cycle, T prev);
+        bool nextNeighbour(T v, size_t &next, T &z) const;
 
-        void distanceFromSourceVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &distance);
+        void distanceFromSourceVisit(T v, std::vector<T> &parent, std::vector<D> &distance, T target = -1);
+
+        void distanceFromSourceVisit(T v, TraversalWorkspace<T, D> &workspace, T target = -1);
 
         bool isBipartiteVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<Color> &partie);
 
-        void longestPathVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::pair<T, std::pair<T, T>> &lPath, std::pair<T, std::pair<T, T>> actualPath, T previous);
+        bool isBipartiteVisit(T v, TraversalWorkspace<T, D> &workspace);
 
-        std::optional<std::pair<T, std::vector<T>>> pathVisitBFS(T v, std::vector<Color> &color, std::vector<T> &parent, std::pair<T, std::vector<T>> path, std::pair<T, T> &param);
 
     public:
         Graph();
@@ -42,8 +87,10 @@ namespace List {
         /**
          * @brief Create a graph
          * @param directed -> the type of the graph DIRECTED or UNDIRECTED, default UNDIRECTED
+         * @param storage -> HEAP, or ARENA to bump-allocate the lists from chunks owned by the graph,
+         * a list that grows leaves its old block in the arena until the graph is destroyed
          */
-        Graph(int size, Type::Graph directed = Type::UNDIRECTED);
+        Graph(size_t size, Type::Graph directed = Type::UNDIRECTED, Type::Storage storage = Type::Storage::HEAP);
 
         /**
          * @brief Create a graph from a matrix
@@ -52,6 +99,15 @@ namespace List {
          */
         Graph(const Graph& graph);
 
+        /**
+         * @brief Take the lists of graph without copying them, graph is left empty
+         */
+        Graph(Graph&& graph) noexcept;
+
+        Graph& operator=(const Graph& graph);
+
+        Graph& operator=(Graph&& graph) noexcept;
+
         ~Graph();
 
         /**
@@ -63,23 +119,28 @@ namespace List {
          * @return the random graph
          */
 
-        static List::Graph<T> createRandomGraph(int numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, double edgeProbability = 0.5, bool includeRandomWeight = false);
+        static List::Graph<T, W, D> createRandomGraph(size_t numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, double edgeProbability = 0.5, bool includeRandomWeight = false, Type::Storage storage = Type::Storage::HEAP);
 
-        static List::Graph<T> createCycleGraph(int numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false);
+        static List::Graph<T, W, D> createCycleGraph(size_t numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false, Type::Storage storage = Type::Storage::HEAP);
 
-        static List::Graph<T> createBlackHoleGraph(int numberOfVertices, Type::Graph directed = Type::Graph::DIRECTED, bool includeRandomWeight = false, T blackHole = 0);
+        static List::Graph<T, W, D> createBlackHoleGraph(size_t numberOfVertices, Type::Graph directed = Type::Graph::DIRECTED, bool includeRandomWeight = false, T blackHole = 0, Type::Storage storage = Type::Storage::HEAP);
 
-        static List::Graph<T> createCompleteGraph(int numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false);
+        static List::Graph<T, W, D> createCompleteGraph(size_t numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false, Type::Storage storage = Type::Storage::HEAP);
 
-        static List::Graph<T> createBipartiteGraph(int numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false);
+        static List::Graph<T, W, D> createBipartiteGraph(size_t numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false, Type::Storage storage = Type::Storage::HEAP);
 
-        static List::Graph<T> createStarGraph(int numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false);
+        static List::Graph<T, W, D> createStarGraph(size_t numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false, Type::Storage storage = Type::Storage::HEAP);
 
         [[nodiscard]] size_t size() const;
 
         [[nodiscard]] Type::Graph directed() const;
 
-        std::vector<std::pair<T, T>> operator[](T vertex) const;
+        /**
+         * @brief Neighbours of a vertex, nothing is copied
+         * @param vertex -> the vertex
+         * @return a view of std::pair(neighbour, weight), invalidated when an edge is added or removed
+         */
+        std::span<const Arc> operator[](T vertex) const;
 
         /**
          * @brief Add an edge to the graph
@@ -87,17 +148,31 @@ namespace List {
          * @param to -> the ending point
          * @param weight -> the weight of the edge
          */
-        void addEdge(T from, T to, T weight = 1.0);
+        void addEdge(T from, T to, Weight weight = 1);
 
         /**
-         * @brief Remove an edge from the graph (hard complexity so use it carefully)
+         * @brief Remove an edge from the graph, the last neighbour takes its place in the adjacency list
+         * expected O(1) with the edge index, O(degres) otherwise
          * @param from -> the starting point
          * @param to -> the ending point
          * @return true if the edge is removed else false
          */
         bool removeEdge(T from, T to);
 
-        bool isEdge(T from, T to);
+        /**
+         * @brief Check if there is an edge between two vertices, expected O(1) with the edge index, O(degres) otherwise
+         * @param from -> the starting point
+         * @param to -> the ending point
+         * @return true if the edge exists
+         */
+        bool isEdge(T from, T to) const;
+
+        /**
+         * @brief Keep a hash index of the edges so isEdge and removeEdge run in expected O(1)
+         * the lists are left as they are, parallel edges are counted and a removal of one of them scans the list of from
+         * @param enabled -> true to build the index, false to drop it
+         */
+        void indexEdges(bool enabled = true);
 
         /**
          * @brief Get the degres of a vertex
@@ -113,19 +188,68 @@ namespace List {
         std::vector<T> BFS(T start = 0);
 
         /**
-         * @brief Get the DFS of the graph
+         * @brief Get the BFS of the graph without allocating, in the memory of a workspace
+         * @param start -> the starting vertex
+         * @param workspace -> holds the order, the parents and the number of edges from the root of each vertex until its next run
+         * @return the BFS, valid until the next run of the workspace
+         */
+        std::span<const T> BFS(T start, TraversalWorkspace<T, D> &workspace);
+
+        /**
+         * @brief Get the BFS of the graph with a direction-optimizing traversal
+         * each level is expanded top-down from the frontier or bottom-up from the unvisited vertices,
+         * whichever is expected to scan fewer edges
+         * levels and distances are the ones of BFS, but a level expanded bottom-up is listed by vertex id and each of its vertices
+         * takes as parent the first frontier vertex of its incoming list, so the order and the parent tree may differ from BFS
+         * @param start -> the starting vertex
+         * @return std::pair(vector of the BFS, direction used for each level)
+         */
+        std::pair<std::vector<T>, std::vector<Type::Direction>> hybridBFS(T start = 0);
+
+        /**
+         * @brief Get the BFS of the graph, every level being expanded by several threads
+         * @param start -> the starting vertex
+         * @param threads -> the number of threads, 0 for one per hardware thread
+         * @return a vector of the BFS, level after level (the order inside a level depends on the threads)
+         */
+        std::vector<T> parallelBFS(T start = 0, size_t threads = 0);
+
+        /**
+         * @brief Get the BFS tree of a vertex, every level being expanded by several threads
+         * @param v -> the root of the tree
+         * @param threads -> the number of threads, 0 for one per hardware thread
+         * @return std::pair(number of edges from v, parent in the tree), -1 for the vertices not reached
+         */
+        std::pair<std::vector<D>, std::vector<T>> parallelBFSTree(T v, size_t threads = 0);
+
+        /**
+         * @brief Get the DFS of the graph, with an explicit stack so deep graphs are safe
          * @param type PREORDER or POSTORDER
          * @return a vector of the DFS
          */
         std::vector<T> DFS(T start = 0, Type::Print type = Type::Print::PREORDER);
 
         /**
-         * @brief Get the DFS of the graph using a stack
+         * @brief Get the DFS of the graph without allocating, in the memory of a workspace
+         * @param type PREORDER or POSTORDER
+         * @return the DFS, valid until the next query on the workspace
+         */
+        std::span<const T> DFS(T start, Type::Print type, TraversalWorkspace<T, D> &workspace);
+
+        /**
+         * @brief Get the DFS of the graph from 0, same as DFS(0, type)
          * @param type PREORDER or POSTORDER
          * @return a vector of the DFS
          */
         std::vector<T> DFS_stack(Type::Print type = Type::Print::PREORDER);
 
+        /**
+         * @brief Get the whole DFS forest: preorder, postorder, parents, discovery and finish times
+         * @param start -> the first root, the other roots are taken in increasing order
+         * @return the DepthFirst::Tree
+         */
+        DepthFirst::Tree<T> DFSTree(T start = 0) const;
+
         /**
          * @brief Check if the graph is bipartite
          * @return true if the graph is bipartite else false
@@ -133,8 +257,14 @@ namespace List {
         bool isBipartite();
 
         /**
-         * @brief Check if the graph has a cycle
-         * @return a vector of edges of the cycle if exist else nothing
+         * @brief Check if the graph is bipartite without allocating, a side is the parity of the BFS level
+         * @return true if the graph is bipartite else false
+         */
+        bool isBipartite(TraversalWorkspace<T, D> &workspace);
+
+        /**
+         * @brief Find a cycle in O(n + m), a directed graph only follows the direction of its edges
+         * @return the vertices of a cycle, the first one repeated at the end, if one exists else nothing
          */
         std::optional<std::vector<T>> cycle();
 
@@ -145,32 +275,54 @@ namespace List {
         bool eulerianCycle();
 
         /**
-         * @brief distance from any vertex
+         * @brief Shortest distance from any vertex (Dijkstra, the weights must not be negative)
+         * @param v -> the vertex
+         * @return a vector of the distance from v, -1 if not reachable
+         */
+        std::vector<D> distanceFrom(T v);
+
+        /**
+         * @brief Shortest distance from any vertex without allocating
+         * @param v -> the vertex
+         * @param workspace -> workspace.distance(w) and workspace.parent(w) hold the result until its next run
+         */
+        void distanceFrom(T v, TraversalWorkspace<T, D> &workspace);
+
+        /**
+         * @brief Shortest distance from any vertex, computed by several threads with delta-stepping
          * @param v -> the vertex
-         * @return a vector of the distance from v
+         * @param threads -> the number of threads, 0 for one per hardware thread
+         * @param delta -> the bucket width, 0 to derive it from the weights and the average degree
+         * @return a vector of the distance from v, -1 if not reachable
          */
-        std::vector<T> distanceFrom(T v);
+        std::vector<D> deltaSteppingDistanceFrom(T v, size_t threads = 0, D delta = 0);
 
         /**
          * @brief Distance from 0
          * @return a vector of the distance from 0
          */
-        std::vector<T> distanceFromSource();
+        std::vector<D> distanceFromSource();
 
         /**
          * @brief Return the longest path
          * @return std::pair(length of the path, std::pair(from, to))
-         * work with a directed graph without cycle (DAG)
+         * work with a directed graph without cycle (DAG), dynamic programming over the DFS postorder
          */
         std::pair<T, std::pair<T, T>> longestPath();
 
         /**
-         * @brief Return the longest path
+         * @brief Return the shortest path
          * @param from -> the starting point
          * @param to -> the ending point
          * @return std::pair(length of the path, std::vector(vertices of the path))
          */
-        std::optional<std::pair<T, std::vector<T>>> path(T from, T to);
+        std::optional<std::pair<D, std::vector<T>>> path(T from, T to);
+
+        /**
+         * @brief Return the shortest path without allocating, the search stops once to is settled
+         * @return std::pair(length of the path, vertices of the path), valid until the next query on the workspace
+         */
+        std::optional<std::pair<D, std::span<const T>>> path(T from, T to, TraversalWorkspace<T, D> &workspace);
 
         /**
          * @brief Check if any vertex is a black hole
@@ -183,82 +335,215 @@ namespace List {
          * @param v -> the vertex
          * @return std::pair(distance, longest vertex)
          */
-        std::optional<std::pair<T, T>> eccentricity(T v);
+        std::optional<std::pair<D, T>> eccentricity(T v);
+
+        /**
+         * @brief Get the eccentricity of a vertex without allocating
+         * @return std::pair(distance, longest vertex)
+         */
+        std::optional<std::pair<D, T>> eccentricity(T v, TraversalWorkspace<T, D> &workspace);
 
         /**
          * @brief Get the radius of the graph
          * @return std::pair(distance, std::pair(from, to))
-         * NOT linear complexity
+         * exact, most vertices are pruned with eccentricity bounds on undirected graphs
          */
-        std::optional<std::pair<T, std::pair<T, T>>> radius();
+        std::optional<std::pair<D, std::pair<T, T>>> radius();
 
         /**
          * @brief Get the diameter of the graph
          * @return std::pair(distance, std::pair(from, to))
-         * NOT linear complexity
+         * exact, most vertices are pruned with eccentricity bounds on undirected graphs
          */
-        std::optional<std::pair<T, std::pair<T, T>>> diameter();
+        std::optional<std::pair<D, std::pair<T, T>>> diameter();
 
         void print();
     };
 
 };
 
-template<typename T>
-List::Graph<T>::Graph() : _d(Type::Graph::UNDIRECTED), _size(0) {}
+template<typename T, typename W, typename D>
+List::Graph<T, W, D>::Graph() : _d(Type::Graph::UNDIRECTED), _size(0) {}
 
-template<typename T>
-List::Graph<T>::Graph(int size, Type::Graph directed) :  _d(directed), _size(size) {
+template<typename T, typename W, typename D>
+List::Graph<T, W, D>::Graph(size_t size, Type::Graph directed, Type::Storage storage) :
+        // the first chunk of the arena holds a few arcs per vertex, the next ones grow geometrically
+        _arena(storage == Type::Storage::ARENA ? std::make_unique<std::pmr::monotonic_buffer_resource>(std::max<size_t>(4096, size_t(size) * 4 * sizeof(Arc))) : nullptr),
+        // the inner lists are built with the allocator of the outer one
+        adjList(size, this->_arena ? this->_arena.get() : std::pmr::get_default_resource()),
+        _size(size), _d(directed) {
     Logger::debug("Creating graph of size " + std::to_string(size) + " and type ...");
-
-    this->adjList = std::vector<std::vector<std::pair<T, T>>>(size);
 }
 
-template<typename T>
-List::Graph<T>::~Graph() {
+template<typename T, typename W, typename D>
+List::Graph<T, W, D>::~Graph() {
     Logger::debug("Deleting graph...");
 }
 
-template<typename T>
-List::Graph<T>::Graph(const List::Graph<T> &graph) : _size(graph._size), _d(graph._d) {
+template<typename T, typename W, typename D>
+List::Graph<T, W, D>::Graph(const List::Graph<T, W, D> &graph) : _size(graph._size), _minWeight(graph._minWeight), _maxWeight(graph._maxWeight), _edgeIndex(graph._edgeIndex), _d(graph._d) {
     Logger::debug("Creating graph from copy...");
 
     this->adjList = graph.adjList;
 }
 
-template<typename T>
-void List::Graph<T>::addEdge(T from, T to, T weight) {
+template<typename T, typename W, typename D>
+List::Graph<T, W, D>::Graph(List::Graph<T, W, D> &&graph) noexcept : _size(graph._size), _minWeight(graph._minWeight), _maxWeight(graph._maxWeight), _edgeIndex(std::move(graph._edgeIndex)), _d(graph._d) {
+    this->takeStorage(graph);
+    graph._edgeIndex.reset();
+    graph._size = 0;
+}
+
+template<typename T, typename W, typename D>
+List::Graph<T, W, D> &List::Graph<T, W, D>::operator=(const List::Graph<T, W, D> &graph) {
+    this->adjList = graph.adjList;
+    this->_size = graph._size;
+    this->_minWeight = graph._minWeight;
+    this->_maxWeight = graph._maxWeight;
+    this->_edgeIndex = graph._edgeIndex;
+    this->_d = graph._d;
+    return *this;
+}
+
+template<typename T, typename W, typename D>
+List::Graph<T, W, D> &List::Graph<T, W, D>::operator=(List::Graph<T, W, D> &&graph) noexcept {
+    if (this == &graph) {
+        return *this;
+    }
+
+    this->takeStorage(graph);
+    this->_size = graph._size;
+    this->_minWeight = graph._minWeight;
+    this->_maxWeight = graph._maxWeight;
+    this->_edgeIndex = std::move(graph._edgeIndex);
+    this->_d = graph._d;
+    graph._edgeIndex.reset();
+    graph._size = 0;
+    return *this;
+}
+
+template<typename T, typename W, typename D>
+void List::Graph<T, W, D>::takeStorage(List::Graph<T, W, D> &graph) noexcept {
+    std::destroy_at(&this->adjList);
+    this->_arena = std::move(graph._arena);
+    std::construct_at(&this->adjList, std::move(graph.adjList));
+
+    std::destroy_at(&graph.adjList);
+    std::construct_at(&graph.adjList);
+}
+
+template<typename T, typename W, typename D>
+void List::Graph<T, W, D>::addEdge(T from, T to, Weight weight) {
     if (from < 0 || from > this->size() - 1) {
         throw std::invalid_argument("'from' need to be between 0 and the _size of the graph - 1");
     } else if (to < 0 || to > this->size() - 1) {
         throw std::invalid_argument("'to' need to be between 0 and the _size of the graph - 1");
     }
 
-    this->adjList[from].emplace_back(to, weight);
+    this->addArc(from, to, weight);
     if (this->_d == Type::UNDIRECTED) {
-        this->adjList[to].emplace_back(from, weight);
+        this->addArc(to, from, weight);
+    }
+
+    this->_minWeight = std::min(this->_minWeight, weight);
+    this->_maxWeight = std::max(this->_maxWeight, weight);
+}
+
+template<typename T, typename W, typename D>
+void List::Graph<T, W, D>::addArc(T from, T to, Weight weight) {
+    if (this->_edgeIndex.has_value()) {
+        this->_edgeIndex->add(from, to, this->adjList[from].size());
+    }
+
+    this->adjList[from].emplace_back(to, weight);
+}
+
+template<typename T, typename W, typename D>
+bool List::Graph<T, W, D>::removeArc(T from, T to) {
+    Adjacency &list = this->adjList[from];
+
+    if (this->_edgeIndex.has_value()) {
+        const auto *entry = this->_edgeIndex->find(from, to);
+        if (entry == nullptr) {
+            return false;
+        }
+
+        // the copies other than the indexed one can be anywhere in the list
+        size_t copies = entry->count;
+        size_t i = copies == 1 ? entry->position : 0;
+        this->_edgeIndex->erase(from, to);
+        while (i < list.size()) {
+            if (list[i].first != to) {
+                i++;
+                continue;
+            }
+            if (i != list.size() - 1 && list.back().first != to) {
+                auto *moved = this->_edgeIndex->find(from, list.back().first);
+                if (moved->position == list.size() - 1) {
+                    moved->position = i;
+                }
+            }
+            list[i] = list.back();
+            list.pop_back();
+            if (--copies == 0) {
+                break;
+            }
+        }
+        return true;
+    }
+
+    size_t before = list.size();
+    for (size_t i = 0; i < list.size();) {
+        if (list[i].first == to) {
+            list[i] = list.back();
+            list.pop_back();
+        } else {
+            i++;
+        }
+    }
+    return list.size() != before;
+}
+
+template<typename T, typename W, typename D>
+void List::Graph<T, W, D>::indexEdges(bool enabled) {
+    if (!enabled) {
+        this->_edgeIndex.reset();
+        return;
+    }
+
+    size_t arcs = 0;
+    for (const auto &list : this->adjList) {
+        arcs += list.size();
+    }
+    this->_edgeIndex.emplace(arcs);
+
+    for (T v = 0; v < this->size(); v++) {
+        const Adjacency &list = this->adjList[v];
+        for (size_t i = 0; i < list.size(); i++) {
+            this->_edgeIndex->add(v, list[i].first, i);
+        }
     }
 }
 
-template<typename T>
-void List::Graph<T>::print() {
+template<typename T, typename W, typename D>
+void List::Graph<T, W, D>::print() {
     for (int i = 0; i < this->size(); i++) {
         std::cout << i << " : ";
-        for (std::pair<T, T> j : this->adjList[i]) {
+        for (const Arc &j : this->adjList[i]) {
             std::cout << j.first << " ";
         }
         std::cout << std::endl;
     }
 }
 
-template<typename T>
-size_t List::Graph<T>::size() const {
+template<typename T, typename W, typename D>
+size_t List::Graph<T, W, D>::size() const {
     return this->_size;
 }
 
 
-template<typename T>
-std::vector<T> List::Graph<T>::BFS(T start) {
+template<typename T, typename W, typename D>
+std::vector<T> List::Graph<T, W, D>::BFS(T start) {
     Logger::debug("BFS algorithm starting...");
 
     std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
@@ -275,15 +560,44 @@ std::vector<T> List::Graph<T>::BFS(T start) {
     return res;
 }
 
-template<typename T>
-void List::Graph<T>::BFSVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &res) {
+template<typename T, typename W, typename D>
+std::span<const T> List::Graph<T, W, D>::BFS(T start, TraversalWorkspace<T, D> &workspace) {
+    workspace.reset(this->size());
+
+    this->BFSVisit(start, workspace);
+    for (T v = 0; v < this->size(); v++) {
+        if (!workspace.reached(v)) {
+            this->BFSVisit(v, workspace);
+        }
+    }
+
+    return workspace.order();
+}
+
+template<typename T, typename W, typename D>
+void List::Graph<T, W, D>::BFSVisit(T v, TraversalWorkspace<T, D> &workspace) {
+    // the order is the queue, the vertices from head are still to be expanded
+    size_t head = workspace.order().size();
+    workspace.reach(v, 0, -1);
+    while (head < workspace.order().size()) {
+        T w = workspace.order()[head++];
+        for (const Arc &z : this->adjList[w]) {
+            if (!workspace.reached(z.first)) {
+                workspace.reach(z.first, workspace.distance(w) + 1, w);
+            }
+        }
+    }
+}
+
+template<typename T, typename W, typename D>
+void List::Graph<T, W, D>::BFSVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &res) {
     std::queue<T> q;
     color[v] = Color::WHITE;
     q.push(v);
     while (!q.empty()) {
         T w = q.front();
         q.pop();
-        for (std::pair<T, T> z : this->adjList[w]) {
+        for (const Arc &z : this->adjList[w]) {
             if (color[z.first] == Color::BLUE) {
                 color[z.first] = Color::WHITE;
                 parent[z.first] = w;
@@ -295,94 +609,223 @@ void List::Graph<T>::BFSVisit(T v, std::vector<Color> &color, std::vector<T> &pa
     }
 }
 
-template<typename T>
-std::vector<T> List::Graph<T>::DFS(T start, Type::Print type) {
-    Logger::debug("DFS algorithm starting...");
+template<typename T, typename W, typename D>
+std::pair<std::vector<T>, std::vector<Type::Direction>> List::Graph<T, W, D>::hybridBFS(T start) {
+    Logger::debug("Hybrid BFS algorithm starting...");
 
     std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
     std::vector<T> parent = std::vector<T>(this->size(), -1);
     std::vector<T> res;
+    std::vector<Type::Direction> levels;
+    res.reserve(this->size());
+
+    // bottom-up steps look for a parent among the incoming edges, which are the outgoing ones when undirected
+    std::pmr::vector<Adjacency> reversed;
+    if (this->_d == Type::DIRECTED) {
+        reversed = std::pmr::vector<Adjacency>(this->size());
+        for (T v = 0; v < this->size(); v++) {
+            for (const Arc &z : this->adjList[v]) {
+                reversed[z.first].emplace_back(v, z.second);
+            }
+        }
+    }
+    const auto &incoming = this->_d == Type::DIRECTED ? reversed : this->adjList;
 
-    this->DFSVisit(start, color, parent, res, type);
+    size_t unexploredEdges = 0;
+    for (const auto &list : this->adjList) {
+        unexploredEdges += list.size();
+    }
+
+    this->hybridBFSVisit(start, color, parent, res, levels, incoming, unexploredEdges);
     for (T v = 0; v < this->size(); v++) {
         if (color[v] == Color::BLUE) {
-            this->DFSVisit(v, color, parent, res, type);
+            this->hybridBFSVisit(v, color, parent, res, levels, incoming, unexploredEdges);
         }
     }
-    return res;
+
+    return {res, levels};
 }
 
-template<typename T>
-void List::Graph<T>::DFSVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &res, Type::Print type) {
+template<typename T, typename W, typename D>
+void List::Graph<T, W, D>::hybridBFSVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &res, std::vector<Type::Direction> &levels, const std::pmr::vector<Adjacency> &incoming, size_t &unexploredEdges) {
+    // switching thresholds from Beamer et al., Direction-Optimizing Breadth-First Search
+    constexpr size_t alpha = 14;
+    constexpr size_t beta = 24;
+
+    std::vector<T> frontier = {v};
+    std::vector<T> next;
     color[v] = Color::WHITE;
-    if (type == Type::Print::PREORDER) {
-        res.push_back(v);
-    }
-    for (std::pair<T, T> w : this->adjList[v]) {
-        if (color[w.first] == Color::BLUE) {
-            parent[w.first] = v;
-            this->DFSVisit(w.first, color, parent, res, type);
+    size_t frontierEdges = this->adjList[v].size();
+    unexploredEdges -= frontierEdges;
+
+    Type::Direction direction = Type::Direction::TOP_DOWN;
+    size_t previousFrontier = 0;
+
+    while (!frontier.empty()) {
+        if (direction == Type::Direction::TOP_DOWN && frontierEdges * alpha > unexploredEdges) {
+            direction = Type::Direction::BOTTOM_UP;
+        } else if (direction == Type::Direction::BOTTOM_UP && frontier.size() < previousFrontier && frontier.size() * beta < this->size()) {
+            direction = Type::Direction::TOP_DOWN;
         }
-    }
-    color[v] = Color::RED;
-    if (type == Type::Print::POSTORDER) {
-        res.push_back(v);
+        levels.push_back(direction);
+
+        next.clear();
+        if (direction == Type::Direction::TOP_DOWN) {
+            for (T w : frontier) {
+                for (const Arc &z : this->adjList[w]) {
+                    if (color[z.first] == Color::BLUE) {
+                        color[z.first] = Color::WHITE;
+                        parent[z.first] = w;
+                        next.push_back(z.first);
+                    }
+                }
+            }
+        } else {
+            // only the current frontier is WHITE here, the next one is coloured once the level is done
+            for (T u = 0; u < this->size(); u++) {
+                if (color[u] != Color::BLUE) {
+                    continue;
+                }
+                for (const Arc &z : incoming[u]) {
+                    if (color[z.first] == Color::WHITE) {
+                        parent[u] = z.first;
+                        next.push_back(u);
+                        break;
+                    }
+                }
+            }
+            for (T u : next) {
+                color[u] = Color::WHITE;
+            }
+        }
+
+        for (T w : frontier) {
+            color[w] = Color::RED;
+            res.push_back(w);
+        }
+
+        frontierEdges = 0;
+        for (T u : next) {
+            frontierEdges += this->adjList[u].size();
+        }
+        unexploredEdges -= frontierEdges;
+
+        previousFrontier = frontier.size();
+        std::swap(frontier, next);
     }
 }
 
-template<typename T>
-std::vector<T> List::Graph<T>::DFS_stack(Type::Print type) {
-    std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
+template<typename T, typename W, typename D>
+std::vector<T> List::Graph<T, W, D>::parallelBFS(T start, size_t threads) {
+    Logger::debug("Parallel BFS algorithm starting...");
+
+    ThreadPool pool(threads);
+    std::vector<std::atomic<bool>> visited(this->size());
     std::vector<T> parent = std::vector<T>(this->size(), -1);
+    std::vector<D> distance = std::vector<D>(this->size(), -1);
     std::vector<T> res;
+    res.reserve(this->size());
 
+    auto forEachNeighbour = [this](T w, auto &&f) {
+        for (const Arc &z : this->adjList[w]) {
+            f(z.first);
+        }
+    };
+
+    Parallel::levelSynchronousBFS(start, visited, parent, distance, res, pool, forEachNeighbour);
     for (T v = 0; v < this->size(); v++) {
-        if (color[v] == Color::BLUE) {
-            DFSVisitStack(v, color, parent, res, type);
+        if (!visited[v].load(std::memory_order_relaxed)) {
+            Parallel::levelSynchronousBFS(v, visited, parent, distance, res, pool, forEachNeighbour);
         }
     }
 
     return res;
 }
 
-template<typename T>
-void List::Graph<T>::DFSVisitStack(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &res, Type::Print type) {
-    std::stack<T> s;
-    color[v] = Color::WHITE;
-    s.push(v);
-    while (!s.empty()) {
-        T w = s.top();
-        s.pop();
-        if (color[w] == Color::RED) {
-            continue;
-        }
-        for (T i = (T(this->adjList[w].size()) - 1); i >= 0; i--) {
-            std::pair<T, T> z = this->adjList[w][i];
-            if (color[z.first] != Color::RED) {
-                color[z.first] = Color::WHITE;
-                parent[z.first] = w;
-                s.push(z.first);
-            }
+template<typename T, typename W, typename D>
+std::pair<std::vector<D>, std::vector<T>> List::Graph<T, W, D>::parallelBFSTree(T v, size_t threads) {
+    Logger::debug("Parallel BFS tree from " + std::to_string(v) + " algorithm starting...");
+
+    ThreadPool pool(threads);
+    std::vector<std::atomic<bool>> visited(this->size());
+    std::vector<T> parent = std::vector<T>(this->size(), -1);
+    std::vector<D> distance = std::vector<D>(this->size(), -1);
+    std::vector<T> res;
+
+    Parallel::levelSynchronousBFS(v, visited, parent, distance, res, pool, [this](T w, auto &&f) {
+        for (const Arc &z : this->adjList[w]) {
+            f(z.first);
         }
-        color[w] = Color::RED;
-        res.push_back(w);
+    });
+
+    return {distance, parent};
+}
+
+template<typename T, typename W, typename D>
+std::vector<T> List::Graph<T, W, D>::DFS(T start, Type::Print type) {
+    Logger::debug("DFS algorithm starting...");
+
+    DepthFirst::OrderVisitor<T> visitor(type);
+    DepthFirst::forest(this->size(), start, [this](T v, size_t &next, T &z) {
+        return this->nextNeighbour(v, next, z);
+    }, visitor);
+
+    return visitor.res;
+}
+
+template<typename T, typename W, typename D>
+std::span<const T> List::Graph<T, W, D>::DFS(T start, Type::Print type, TraversalWorkspace<T, D> &workspace) {
+    workspace.reset(this->size());
+
+    // the visitor borrows the memory of the buffer and gives it back
+    DepthFirst::OrderVisitor<T> visitor(type);
+    visitor.res = std::move(workspace.buffer());
+    visitor.res.clear();
+    DepthFirst::forest(this->size(), start, workspace, workspace.stack(), [this](T v, size_t &next, T &z) {
+        return this->nextNeighbour(v, next, z);
+    }, visitor);
+    workspace.buffer() = std::move(visitor.res);
+
+    return workspace.buffer();
+}
+
+template<typename T, typename W, typename D>
+DepthFirst::Tree<T> List::Graph<T, W, D>::DFSTree(T start) const {
+    Logger::debug("DFS tree algorithm starting...");
+
+    return DepthFirst::tree(this->size(), start, [this](T v, size_t &next, T &z) {
+        return this->nextNeighbour(v, next, z);
+    });
+}
+
+template<typename T, typename W, typename D>
+bool List::Graph<T, W, D>::nextNeighbour(T v, size_t &next, T &z) const {
+    if (next == this->adjList[v].size()) {
+        return false;
     }
+    z = this->adjList[v][next++].first;
+    return true;
+}
+
+template<typename T, typename W, typename D>
+std::vector<T> List::Graph<T, W, D>::DFS_stack(Type::Print type) {
+    return this->DFS(0, type);
 }
 
-template<typename T>
-List::Graph<T> List::Graph<T>::createRandomGraph(int numberOfVertices, Type::Graph directed, double edgeProbability, bool includeRandomWeight) {
+template<typename T, typename W, typename D>
+List::Graph<T, W, D> List::Graph<T, W, D>::createRandomGraph(size_t numberOfVertices, Type::Graph directed, double edgeProbability, bool includeRandomWeight, Type::Storage storage) {
     Logger::debug("Creating random graph with " + std::to_string(numberOfVertices) + " vertices and edge probability " + std::to_string(edgeProbability) + "...");
 
-    if (numberOfVertices <= 0 || edgeProbability < 0.0 || edgeProbability > 1.0) {
+    if (numberOfVertices == 0 || edgeProbability < 0.0 || edgeProbability > 1.0) {
         throw std::invalid_argument("Invalid input parameters.");
     }
 
     std::random_device rd;
     std::mt19937 gen(rd());
     std::uniform_real_distribution<double> edgeDist(0.0, 1.0);
-    std::uniform_int_distribution<T> weightDist(1, 100); // Random weight between 1 and 100
+    std::uniform_int_distribution<int> weightDist(1, 100); // Random weight between 1 and 100
 
-    List::Graph g = List::Graph<T>(numberOfVertices, directed);
+    List::Graph g = List::Graph<T, W, D>(numberOfVertices, directed, storage);
     for (T i = 0; i < numberOfVertices; i++) {
         for (T j = i + 1; j < numberOfVertices; j++) {
             if (edgeDist(gen) < edgeProbability) {
@@ -398,92 +841,85 @@ List::Graph<T> List::Graph<T>::createRandomGraph(int numberOfVertices, Type::Gra
     return g;
 }
 
-template<typename T>
-std::optional<std::vector<T>> List::Graph<T>::cycle() {
+template<typename T, typename W, typename D>
+std::optional<std::vector<T>> List::Graph<T, W, D>::cycle() {
     Logger::debug("Cycle algorithm starting...");
-    std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
-    std::vector<T> parent = std::vector<T>(this->size(), -1);
-    std::vector<T> cycle;
 
-    for (T v = 0; v < this->size(); v++) {
-        if (color[v] == Color::BLUE) {
-            if (this->cycleVisit(v, color, parent, cycle, -1)) {
-                return cycle;
-            }
-        }
+    DepthFirst::CycleVisitor<T> visitor(this->size(), this->_d == Type::DIRECTED);
+    DepthFirst::forest(this->size(), T(0), [this](T v, size_t &next, T &z) {
+        return this->nextNeighbour(v, next, z);
+    }, visitor);
+
+    if (visitor.stopped) {
+        return visitor.cycle;
     }
     return std::nullopt;
 }
 
-template<typename T>
-bool List::Graph<T>::cycleVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &cycle, T prev) {
-    color[v] = Color::WHITE;
-    if (vectorUtils<T>::isInVector(cycle, v)) {
-        cycle.push_back(v);
-        return true;
-    }
-
-    cycle.push_back(v);
-
-    for (std::pair<T, T> w : this->adjList[v]) {
-        if (color[w.first] == Color::BLUE) {
-            parent[w.first] = v;
-            if (this->cycleVisit(w.first, color, parent, cycle, v)) {
-                return true;
-            }
-        } else if (w.first != prev) {
-            cycle.push_back(w.first);
-            return true;
-        }
-    }
+template<typename T, typename W, typename D>
+std::vector<D> List::Graph<T, W, D>::distanceFrom(T v) {
+    Logger::debug("Distance from " + std::to_string(v) + " algorithm starting...");
+    std::vector<T> parent = std::vector<T>(this->size(), -1);
+    std::vector<D> distance = std::vector<D>(this->size(), -1);
 
-    color[v] = Color::RED;
+    this->distanceFromSourceVisit(v, parent, distance);
 
-    vectorUtils<T>::removeElementsFromVector(cycle, v);
+    return distance;
+}
 
-    return false;
+template<typename T, typename W, typename D>
+void List::Graph<T, W, D>::distanceFrom(T v, TraversalWorkspace<T, D> &workspace) {
+    this->distanceFromSourceVisit(v, workspace);
 }
 
-template<typename T>
-std::vector<T> List::Graph<T>::distanceFrom(T v) {
-    Logger::debug("Distance from " + std::to_string(v) + " algorithm starting...");
-    std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
-    std::vector<T> parent = std::vector<T>(this->size(), -1);
-    std::vector<T> distance = std::vector<T>(this->size());
+template<typename T, typename W, typename D>
+std::vector<D> List::Graph<T, W, D>::deltaSteppingDistanceFrom(T v, size_t threads, D delta) {
+    Logger::debug("Delta-stepping distance from " + std::to_string(v) + " algorithm starting...");
 
-    this->distanceFromSourceVisit(v, color, parent, distance);
+    if (delta == 0) {
+        size_t arcs = 0;
+        for (const auto &list : this->adjList) {
+            arcs += list.size();
+        }
+        delta = ShortestPath::autoDelta(this->size(), arcs, D(this->_maxWeight));
+    }
 
-    return distance;
+    ThreadPool pool(threads);
+    return ShortestPath::deltaStepping(v, this->size(), D(this->_minWeight), delta, pool, [this](T w, auto &&relax) {
+        for (const Arc &z : this->adjList[w]) {
+            relax(z.first, D(z.second));
+        }
+    });
 }
 
-template<typename T>
-std::vector<T> List::Graph<T>::distanceFromSource() {
+template<typename T, typename W, typename D>
+std::vector<D> List::Graph<T, W, D>::distanceFromSource() {
     return this->distanceFrom(0);
 }
 
-template<typename T>
-void List::Graph<T>::distanceFromSourceVisit(T v, std::vector<Color> &color, std::vector<T> &parent,
-                                          std::vector<T> &distance) {
-    std::queue<T> q;
-    color[v] = Color::WHITE;
-    q.push(v);
-    while (!q.empty()) {
-        T w = q.front();
-        q.pop();
-        for (std::pair<T, T> z : this->adjList[w]) {
-            if (color[z.first] == Color::BLUE) {
-                color[z.first] = Color::WHITE;
-                parent[z.first] = w;
-                distance[z.first] = distance[w] + z.second;
-                q.push(z.first);
-            }
+template<typename T, typename W, typename D>
+void List::Graph<T, W, D>::distanceFromSourceVisit(T v, std::vector<T> &parent, std::vector<D> &distance, T target) {
+    ShortestPath::dijkstra(v, distance, parent, D(this->_minWeight), D(this->_maxWeight), [this](T w, auto &&relax) {
+        for (const Arc &z : this->adjList[w]) {
+            relax(z.first, D(z.second));
         }
-        color[w] = Color::RED;
-    }
+    }, target);
 }
 
-template<typename T>
-bool List::Graph<T>::isBipartite() {
+template<typename T, typename W, typename D>
+void List::Graph<T, W, D>::distanceFromSourceVisit(T v, TraversalWorkspace<T, D> &workspace, T target) {
+    workspace.reset(this->size());
+    workspace.queues().with(D(this->_minWeight), D(this->_maxWeight), [&](auto &queue) {
+        ShortestPath::settle(v, workspace, queue, [this](T w, auto &&relax) {
+            for (const Arc &z : this->adjList[w]) {
+                relax(z.first, D(z.second));
+            }
+        }, target);
+    });
+}
+
+template<typename T, typename W, typename D>
+bool List::Graph<T, W, D>::isBipartite() {
     Logger::debug("Bipartite algorithm starting...");
     std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
     std::vector<Color> partie = std::vector<Color>(this->size(), Color::NONE);
@@ -501,8 +937,38 @@ bool List::Graph<T>::isBipartite() {
     return true;
 }
 
-template<typename T>
-bool List::Graph<T>::isBipartiteVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<Color> &partie) {
+template<typename T, typename W, typename D>
+bool List::Graph<T, W, D>::isBipartite(TraversalWorkspace<T, D> &workspace) {
+    workspace.reset(this->size());
+
+    for (T v = 0; v < this->size(); v++) {
+        if (!workspace.reached(v) && !this->isBipartiteVisit(v, workspace)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T, typename W, typename D>
+bool List::Graph<T, W, D>::isBipartiteVisit(T v, TraversalWorkspace<T, D> &workspace) {
+    size_t head = workspace.order().size();
+    workspace.reach(v, 0, -1);
+    while (head < workspace.order().size()) {
+        T w = workspace.order()[head++];
+        D level = workspace.distance(w);
+        for (const Arc &z : this->adjList[w]) {
+            if (!workspace.reached(z.first)) {
+                workspace.reach(z.first, level + 1, w);
+            } else if (size_t(workspace.distance(z.first)) % 2 == size_t(level) % 2) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template<typename T, typename W, typename D>
+bool List::Graph<T, W, D>::isBipartiteVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<Color> &partie) {
     std::queue<T> q;
     color[v] = Color::WHITE;
     q.push(v);
@@ -510,7 +976,7 @@ bool List::Graph<T>::isBipartiteVisit(T v, std::vector<Color> &color, std::vecto
         T w = q.front();
         q.pop();
         Color nextColor = partie[w] == Color::BLUE ? Color::RED : Color::BLUE;
-        for (std::pair<T, T> z : this->adjList[w]) {
+        for (const Arc &z : this->adjList[w]) {
 
             // PART TO CHECK IF THE GRAPH IS BIPARTITE
             if (partie[z.first] != Color::NONE) {
@@ -533,108 +999,86 @@ bool List::Graph<T>::isBipartiteVisit(T v, std::vector<Color> &color, std::vecto
     return true;
 }
 
-template<typename T>
-std::pair<T, std::pair<T, T>> List::Graph<T>::longestPath() {
+template<typename T, typename W, typename D>
+std::pair<T, std::pair<T, T>> List::Graph<T, W, D>::longestPath() {
     Logger::debug("Longest path algorithm starting...");
     if (this->_d != Type::DIRECTED) {
         std::cout << "" << std::endl;
         throw std::invalid_argument("The graph must be directed");
     }
 
-    std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
-    std::vector<T> parent = std::vector<T>(this->size(), -1);
-    std::pair<T, std::pair<T, T>> lPath = {0, {0, 0}};
-    std::pair<T, std::pair<T, T>> actualPath = {0, {0, 0}};
+    DepthFirst::OrderVisitor<T> visitor(Type::Print::POSTORDER);
+    DepthFirst::forest(this->size(), T(0), [this](T v, size_t &next, T &z) {
+        return this->nextNeighbour(v, next, z);
+    }, visitor);
 
-    for (T v = 0; v < this->size(); v++) {
-        if (color[v] == Color::BLUE) {
-            actualPath = {0, {v, v}};
-            this->longestPathVisit(v, color, parent, lPath, actualPath, -1);
-        }
+    if (visitor.backEdge) {
+        throw std::invalid_argument("The graph must not have a cycle");
     }
 
-    return lPath;
-}
-
-template<typename T>
-void List::Graph<T>::longestPathVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::pair<T, std::pair<T, T>> &lPath, std::pair<T, std::pair<T, T>> actualPath, T previous) {
-    color[v] = Color::WHITE;
-    actualPath.first += 1;
-
-    for (std::pair<T, T> w : this->adjList[v]) {
-        if (w.first != previous) {
-            Logger::debug("New path found : " + std::to_string(actualPath.first) + " from " + std::to_string(actualPath.second.first) + " to " + std::to_string(actualPath.second.second));
-            actualPath.second.second = w.first;
-
-            if (actualPath.first > lPath.first) {
-                lPath = actualPath;
+    // longest[v] = std::pair(edges, last vertex) of the longest path from v, its successors come first in postorder
+    std::vector<std::pair<T, T>> longest(this->size());
+    for (T v : visitor.res) {
+        longest[v] = {0, v};
+        for (const Arc &w : this->adjList[v]) {
+            if (longest[w.first].first + 1 > longest[v].first) {
+                longest[v] = {longest[w.first].first + 1, longest[w.first].second};
             }
         }
+    }
 
-        if (w.first != previous) {
-            Logger::debug("New path found : " + std::to_string(actualPath.first) + " from " + std::to_string(actualPath.second.first) + " to " + std::to_string(actualPath.second.second));
-            parent[w.first] = v;
-            this->longestPathVisit(w.first, color, parent, lPath, actualPath, v);
+    std::pair<T, std::pair<T, T>> lPath = {0, {0, 0}};
+    for (T v = 0; v < this->size(); v++) {
+        if (longest[v].first > lPath.first) {
+            lPath = {longest[v].first, {v, longest[v].second}};
         }
     }
-    color[v] = Color::RED;
+
+    return lPath;
 }
 
-template<typename T>
-std::optional<std::pair<T, std::vector<T>>> List::Graph<T>::path(T from, T to) {
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, std::vector<T>>> List::Graph<T, W, D>::path(T from, T to) {
     Logger::debug("Path algorithm starting...");
-    if (from < 0 || from > this->size() || to < 0 || to > this->size()) {
+    if (from < 0 || from > this->size() - 1 || to < 0 || to > this->size() - 1) {
         throw std::invalid_argument("int param have to be between 0 and the _size of the graph");
     }
 
-    std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
     std::vector<T> parent = std::vector<T>(this->size(), -1);
-    std::pair<T, std::vector<T>> path = {0, {from}};
-    std::pair<T, T> param = {from, to};
+    std::vector<D> distance = std::vector<D>(this->size(), -1);
 
-    return this->pathVisitBFS(from, color, parent, path, param);
-}
+    this->distanceFromSourceVisit(from, parent, distance, to);
 
-template<typename T>
-std::optional<std::pair<T, std::vector<T>>> List::Graph<T>::pathVisitBFS(T v, std::vector<Color> &color, std::vector<T> &parent, std::pair<T, std::vector<T>> path, std::pair<T, T> &param) {
+    if (distance[to] == -1) {
+        return std::nullopt;
+    }
 
-    std::vector<T> distance = std::vector<T>(this->size());
-    std::queue<T> q;
-    color[v] = Color::WHITE;
-    q.push(v);
-    while (!q.empty()) {
-        T w = q.front();
-        q.pop();
-        for (std::pair<T, T> z : this->adjList[w]) {
-            if (color[z.first] == Color::BLUE) {
-                color[z.first] = Color::WHITE;
-                parent[z.first] = w;
-                distance[z.first] = distance[w] + z.second;
-                q.push(z.first);
+    Logger::debug("Path found !");
+    std::pair<D, std::vector<T>> path = {distance[to], {}};
+    for (T tmp = to; tmp != -1; tmp = parent[tmp]) {
+        path.second.push_back(tmp);
+    }
+    std::reverse(path.second.begin(), path.second.end());
 
-                if (z.first == param.second) {
-                    Logger::debug("Path found !");
-                    path.second = {};
-                    T tmp = z.first;
-                    while (tmp != -1) {
-                        path.second.insert(path.second.begin(), tmp);
-                        tmp = parent[tmp];
-                    }
+    return path;
+}
 
-                    path.first = distance[z.first];
-                    return path;
-                }
-            }
-        }
-        color[w] = Color::RED;
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, std::span<const T>>> List::Graph<T, W, D>::path(T from, T to, TraversalWorkspace<T, D> &workspace) {
+    if (from < 0 || from > this->size() - 1 || to < 0 || to > this->size() - 1) {
+        throw std::invalid_argument("int param have to be between 0 and the _size of the graph");
     }
 
-    return std::nullopt;
-}
+    this->distanceFromSourceVisit(from, workspace, to);
 
+    if (!workspace.reached(to)) {
+        return std::nullopt;
+    }
+    return std::make_pair(workspace.distance(to), workspace.pathTo(to));
+}
 
-template<typename T>
-bool List::Graph<T>::removeEdge(T from, T to) {
+template<typename T, typename W, typename D>
+bool List::Graph<T, W, D>::removeEdge(T from, T to) {
     Logger::debug("Removing edge " + std::to_string(from) + " -> " + std::to_string(to));
     if (from < 0 || from > this->size() - 1) {
         throw std::invalid_argument("'from' need to be between 0 and the _size of the graph - 1");
@@ -642,35 +1086,20 @@ bool List::Graph<T>::removeEdge(T from, T to) {
         throw std::invalid_argument("'to' need to be between 0 and the _size of the graph - 1");
     }
 
-    bool res = false;
-    for (T i = 0; i < this->adjList[from].size(); i++) {
-        if (this->adjList[from][i].first == to) {
-            this->adjList[from].erase(this->adjList[from].begin() + i);
-            res = true;
-        }
-    }
-
-    if (!res) {
+    if (!this->removeArc(from, to)) {
         Logger::debug("Edge " + std::to_string(from) + " -> " + std::to_string(to) + " not found");
         return false;
     }
 
-    if (this->_d == Type::UNDIRECTED) {
-        res = false;
-
-        for (T i = 0; i < this->adjList[to].size(); i++) {
-            if (this->adjList[to][i].first == from) {
-                this->adjList[to].erase(this->adjList[to].begin() + i);
-                res = true;
-            }
-        }
+    if (this->_d == Type::UNDIRECTED && from != to) {
+        this->removeArc(to, from);
     }
 
-    return res;
+    return true;
 }
 
-template<typename T>
-bool List::Graph<T>::eulerianCycle() {
+template<typename T, typename W, typename D>
+bool List::Graph<T, W, D>::eulerianCycle() {
     Logger::debug("Eulerian cycle algorithm starting...");
     for (const auto& u : this->adjList) {
         if (u.size() % 2 != 0) {
@@ -682,12 +1111,12 @@ bool List::Graph<T>::eulerianCycle() {
     return true;
 }
 
-template<typename T>
-std::optional<T> List::Graph<T>::blackHole() {
+template<typename T, typename W, typename D>
+std::optional<T> List::Graph<T, W, D>::blackHole() {
     Logger::debug("Black hole algorithm starting...");
     T candidate = 0;
     for (T i = 1; i < this->size(); i++) {
-        for (T u : this->adjList[candidate]) {
+        for (const Arc &u : this->adjList[candidate]) {
             if (u.first == i) {
                 Logger::debug("New candidate : " + std::to_string(i));
                 candidate = i;
@@ -721,11 +1150,11 @@ std::optional<T> List::Graph<T>::blackHole() {
     return Ok ? std::optional<T>(candidate) : std::nullopt;
 }
 
-template<typename T>
-std::optional<std::pair<T, T>> List::Graph< T>::eccentricity(T v) {
-    std::optional<std::pair<T, T>> res;
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, T>> List::Graph<T, W, D>::eccentricity(T v) {
+    std::optional<std::pair<D, T>> res;
 
-    std::vector<T> dist = this->distanceFrom(v);
+    std::vector<D> dist = this->distanceFrom(v);
 
     for (T i = 0; i < this->size(); i++) {
         if (dist[i] > -1 && (!res.has_value() || res.value().first < dist[i]) && i != v) {
@@ -736,36 +1165,30 @@ std::optional<std::pair<T, T>> List::Graph< T>::eccentricity(T v) {
     return res;
 }
 
-template<typename T>
-std::optional<std::pair<T, std::pair<T, T>>> List::Graph<T>::radius() {
-    std::optional<std::pair<T, std::pair<T, T>>> minEccentricity;
-
-    for (T i = 0; i < this->size(); i++) {
-        auto ecc = this->eccentricity(i);
-        if (ecc.has_value() && (!minEccentricity.has_value() || minEccentricity.value().first > ecc.value().first)) {
-            minEccentricity = {ecc.value().first, {i, ecc.value().second}};
-        }
-    }
-
-    return minEccentricity;
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, T>> List::Graph<T, W, D>::eccentricity(T v, TraversalWorkspace<T, D> &workspace) {
+    this->distanceFromSourceVisit(v, workspace);
+    return Eccentricity::farthest(v, workspace);
 }
 
-template<typename T>
-std::optional<std::pair<T, std::pair<T, T>>> List::Graph<T>::diameter() {
-    std::optional<std::pair<T, std::pair<T, T>>> minEccentricity;
-
-    for (T i = 0; i < this->size(); i++) {
-        auto ecc = this->eccentricity(i);
-        if (ecc.has_value() && (!minEccentricity.has_value() || minEccentricity.value().first < ecc.value().first)) {
-            minEccentricity = {ecc.value().first, {i, ecc.value().second}};
-        }
-    }
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, std::pair<T, T>>> List::Graph<T, W, D>::radius() {
+    Logger::debug("Radius algorithm starting...");
+    return Eccentricity::boundingDiameters<T, D>(this->size(), this->_d == Type::UNDIRECTED, false, [this](T v, TraversalWorkspace<T, D> &workspace) {
+        this->distanceFromSourceVisit(v, workspace);
+    });
+}
 
-    return minEccentricity;
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, std::pair<T, T>>> List::Graph<T, W, D>::diameter() {
+    Logger::debug("Diameter algorithm starting...");
+    return Eccentricity::boundingDiameters<T, D>(this->size(), this->_d == Type::UNDIRECTED, true, [this](T v, TraversalWorkspace<T, D> &workspace) {
+        this->distanceFromSourceVisit(v, workspace);
+    });
 }
 
-template<typename T>
-int List::Graph<T>::degres(T vertex) {
+template<typename T, typename W, typename D>
+int List::Graph<T, W, D>::degres(T vertex) {
     if (vertex < 0 || vertex > this->size()) {
         throw std::invalid_argument("'edge' must be between 0 and the size of the graph !");
     }
@@ -773,57 +1196,60 @@ int List::Graph<T>::degres(T vertex) {
     return int(this->adjList[vertex].size());
 }
 
-template<typename T>
-Type::Graph List::Graph<T>::directed() const {
+template<typename T, typename W, typename D>
+Type::Graph List::Graph<T, W, D>::directed() const {
     return _d;
 }
 
-template<typename T>
-std::vector<std::pair<T, T>> List::Graph<T>::operator[](T vertex) const {
+template<typename T, typename W, typename D>
+std::span<const typename List::Graph<T, W, D>::Arc> List::Graph<T, W, D>::operator[](T vertex) const {
     return this->adjList[vertex];
 }
 
-template<typename T>
-bool List::Graph<T>::isEdge(T from, T to) {
-    std::ranges::any_of(this->adjList[from], [to](std::pair<T, T> u) {
+template<typename T, typename W, typename D>
+bool List::Graph<T, W, D>::isEdge(T from, T to) const {
+    if (this->_edgeIndex.has_value()) {
+        return this->_edgeIndex->find(from, to) != nullptr;
+    }
+
+    return std::ranges::any_of(this->adjList[from], [to](const Arc &u) {
         return u.first == to;
     });
-    return false;
 }
 
-template<typename T>
-List::Graph<T> List::Graph<T>::createCycleGraph(int numberOfVertices, Type::Graph directed, bool includeRandomWeight) {
+template<typename T, typename W, typename D>
+List::Graph<T, W, D> List::Graph<T, W, D>::createCycleGraph(size_t numberOfVertices, Type::Graph directed, bool includeRandomWeight, Type::Storage storage) {
     Logger::debug("Creating cycle graph with " + std::to_string(numberOfVertices) + " vertices.");
 
-    if (numberOfVertices <= 0) {
+    if (numberOfVertices == 0) {
         throw std::invalid_argument("Invalid input parameters.");
     }
 
     std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<T> weightDist(1, 100); // Random weight between 1 and 100
+    std::uniform_int_distribution<int> weightDist(1, 100); // Random weight between 1 and 100
 
 
-    List::Graph g = List::Graph<T>(numberOfVertices, directed);
-    for (int i = 0; i < numberOfVertices; i++) {
+    List::Graph g = List::Graph<T, W, D>(numberOfVertices, directed, storage);
+    for (T i = 0; i < numberOfVertices; i++) {
         g.addEdge(i, (i + 1) % numberOfVertices, includeRandomWeight ? weightDist(gen) : 1);
     }
     return g;
 }
 
-template<typename T>
-List::Graph<T> List::Graph<T>::createBlackHoleGraph(int numberOfVertices, Type::Graph directed, bool includeRandomWeight, T blackHole) {
+template<typename T, typename W, typename D>
+List::Graph<T, W, D> List::Graph<T, W, D>::createBlackHoleGraph(size_t numberOfVertices, Type::Graph directed, bool includeRandomWeight, T blackHole, Type::Storage storage) {
     Logger::debug("Creating black hole graph with " + std::to_string(numberOfVertices) + " vertices.\nStarting black hole at " + std::to_string(blackHole));
 
-    if (numberOfVertices <= 0) {
+    if (numberOfVertices == 0) {
         throw std::invalid_argument("Invalid input parameters.");
     }
 
     std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<T> weightDist(1, 100); // Random weight between 1 and 100
+    std::uniform_int_distribution<int> weightDist(1, 100); // Random weight between 1 and 100
 
-    List::Graph g = List::Graph<T>(numberOfVertices, directed);
+    List::Graph g = List::Graph<T, W, D>(numberOfVertices, directed, storage);
     for (T i = 0; i < numberOfVertices; i++) {
         if (i != blackHole) {
             g.addEdge(i, blackHole, includeRandomWeight ? weightDist(gen) : 1);
@@ -832,19 +1258,23 @@ List::Graph<T> List::Graph<T>::createBlackHoleGraph(int numberOfVertices, Type::
     return g;
 }
 
-template<typename T>
-List::Graph<T> List::Graph<T>::createCompleteGraph(int numberOfVertices, Type::Graph directed, bool includeRandomWeight) {
+template<typename T, typename W, typename D>
+List::Graph<T, W, D> List::Graph<T, W, D>::createCompleteGraph(size_t numberOfVertices, Type::Graph directed, bool includeRandomWeight, Type::Storage storage) {
     Logger::debug("Creating complete graph with " + std::to_string(numberOfVertices) + " vertices.");
 
-    if (numberOfVertices <= 0) {
+    if (numberOfVertices == 0) {
         throw std::invalid_argument("Invalid input parameters.");
     }
 
     std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<T> weightDist(1, 100); // Random weight between 1 and 100
+    std::uniform_int_distribution<int> weightDist(1, 100); // Random weight between 1 and 100
 
-    List::Graph g = List::Graph<T>(numberOfVertices, directed);
+    List::Graph g = List::Graph<T, W, D>(numberOfVertices, directed, storage);
+    // the degrees are known, so no list grows and an arena keeps no abandoned block
+    for (T i = 0; i < numberOfVertices; i++) {
+        g.adjList[i].reserve(directed == Type::Graph::UNDIRECTED ? numberOfVertices - 1 : numberOfVertices - 1 - i);
+    }
     for (T i = 0; i < numberOfVertices; i++) {
         for (T j = i + 1; j < numberOfVertices; j++) {
             g.addEdge(i, j, includeRandomWeight ? weightDist(gen) : 1);
@@ -853,19 +1283,19 @@ List::Graph<T> List::Graph<T>::createCompleteGraph(int numberOfVertices, Type::G
     return g;
 }
 
-template<typename T>
-List::Graph<T> List::Graph<T>::createBipartiteGraph(int numberOfVertices, Type::Graph directed, bool includeRandomWeight) {
+template<typename T, typename W, typename D>
+List::Graph<T, W, D> List::Graph<T, W, D>::createBipartiteGraph(size_t numberOfVertices, Type::Graph directed, bool includeRandomWeight, Type::Storage storage) {
     Logger::debug("Creating bipartite graph with " + std::to_string(numberOfVertices) + " vertices");
 
-    if (numberOfVertices <= 0) {
+    if (numberOfVertices == 0) {
         throw std::invalid_argument("Invalid input parameters.");
     }
 
     std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<T> weightDist(1, 100); // Random weight between 1 and 100
+    std::uniform_int_distribution<int> weightDist(1, 100); // Random weight between 1 and 100
 
-    List::Graph g = List::Graph<T>(numberOfVertices, directed);
+    List::Graph g = List::Graph<T, W, D>(numberOfVertices, directed, storage);
     for (T i = 0; i < numberOfVertices / 2; i++) {
         for (T j = numberOfVertices / 2; j < numberOfVertices; j++) {
             g.addEdge(i, j, includeRandomWeight ? weightDist(gen) : 1);
@@ -874,19 +1304,19 @@ List::Graph<T> List::Graph<T>::createBipartiteGraph(int numberOfVertices, Type::
     return g;
 }
 
-template<typename T>
-List::Graph<T> List::Graph<T>::createStarGraph(int numberOfVertices, Type::Graph directed, bool includeRandomWeight) {
+template<typename T, typename W, typename D>
+List::Graph<T, W, D> List::Graph<T, W, D>::createStarGraph(size_t numberOfVertices, Type::Graph directed, bool includeRandomWeight, Type::Storage storage) {
     Logger::debug("Creating star graph with " + std::to_string(numberOfVertices) + " vertices");
 
-    if (numberOfVertices <= 0) {
+    if (numberOfVertices == 0) {
         throw std::invalid_argument("Invalid input parameters.");
     }
 
     std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<T> weightDist(1, 100); // Random weight between 1 and 100
+    std::uniform_int_distribution<int> weightDist(1, 100); // Random weight between 1 and 100
 
-    List::Graph g = List::Graph<T>(numberOfVertices, directed);
+    List::Graph g = List::Graph<T, W, D>(numberOfVertices, directed, storage);
     for (T i = 1; i < numberOfVertices; i++) {
         g.addEdge(0, i, includeRandomWeight ? weightDist(gen) : 1);
     }
@@ -2,8 +2,17 @@
 
 #include "Utils.hpp"
 #include "Logger.hpp"
-
+#include "Gemm.hpp"
+#include "Strassen.hpp"
+#include "Expression.hpp"
+#include "Aligned.hpp"
+#include "ThreadPool.hpp"
+
+#include <bit>
+#include <vector>
+#include <cstdint>
 #include <cstring>
+#include <stdexcept>
 #include <iostream>
 #include <iomanip>
 
@@ -17,7 +26,7 @@ namespace Matrix {
     template <typename T = int>
     class adjacentMatrix {
     protected:
-        std::pair<T, T> *_m;
+        Aligned::Vector<std::pair<T, T>> _m;
 
         size_t _size;
 
@@ -25,12 +34,29 @@ namespace Matrix {
 
         adjacentMatrix(size_t size);
 
+        /**
+         * @brief Copy the cells of a square matrix, row-major
+         * @param vec -> size * size cells
+         */
         adjacentMatrix(const std::vector<std::pair<T, T>>& vec);
 
-        adjacentMatrix(const std::pair<T, T>* data);
+        /**
+         * @brief Copy the cells of a square matrix, row-major
+         * @param data -> size * size cells
+         */
+        adjacentMatrix(const std::pair<T, T>* data, size_t size);
 
         adjacentMatrix(const adjacentMatrix<T>& other);
 
+        /**
+         * @brief Take the cells of other, which is left empty
+         */
+        adjacentMatrix(adjacentMatrix<T>&& other) noexcept;
+
+        adjacentMatrix& operator=(const adjacentMatrix<T>& other);
+
+        adjacentMatrix& operator=(adjacentMatrix<T>&& other) noexcept;
+
         ~adjacentMatrix();
 
         size_t size() const;
@@ -61,6 +87,93 @@ namespace Matrix {
         };
     };
 
+    /**
+     * @brief Adjacency matrix of size x size stored as a row-major bitset, a row is size / 64 words of 64 bits
+     * the weights of a row are kept next to its bits, in the order of the set bits, so the k-th neighbour of a row has the k-th weight
+     * and a scan of the row reads them in sequence, a row with every weight at 1 stores none
+     * weight(row, col) counts the bits before col, so a lookup of one cell is O(size / 64), setting an edge shifts the weights of its row
+     * at() and operator() return std::pair(1 if there is an edge else 0, weight) by value
+     * @tparam T the weights, Type::Unweighted keeps only the bits
+     */
+    template <typename T = int>
+    class bitAdjacentMatrix {
+    protected:
+        size_t _size;
+        size_t _words;
+        std::vector<uint64_t> _bits;
+        std::vector<std::vector<T>> _weights;
+
+        static constexpr bool weighted = !std::is_same_v<T, Type::Unweighted>;
+
+        /**
+         * @brief Number of set bits of a row before col
+         */
+        size_t rank(size_t row, size_t col) const;
+
+    public:
+
+        bitAdjacentMatrix(size_t size);
+
+        size_t size() const;
+
+        /**
+         * @brief Number of 64 bits words in a row
+         */
+        size_t words() const;
+
+        /**
+         * @brief The words of a row, bit j % 64 of word j / 64 is set if there is an edge row -> j
+         */
+        const uint64_t* row(size_t row) const;
+
+        bool test(size_t row, size_t col) const;
+
+        /**
+         * @brief Weight of the cell, it is only meaningful if the bit is set
+         */
+        T weight(size_t row, size_t col) const;
+
+        /**
+         * @brief Weight of the k-th set bit of a row, the neighbours of a row read their weights in sequence with it
+         */
+        T weightOf(size_t row, size_t k) const;
+
+        /**
+         * @brief Number of set bits of a row
+         */
+        size_t count(size_t row) const;
+
+        inline std::pair<int, T> operator()(size_t row, size_t col) const;
+
+        inline void operator()(size_t row, size_t col, std::pair<int, T> value);
+
+        std::pair<int, T> at(size_t row, size_t col) const;
+
+        /**
+         * @brief Set a cell, value.first == 0 removes the edge
+         */
+        void set(size_t row, size_t col, const std::pair<int, T>& value);
+
+        friend std::ostream& operator << (std::ostream& os, const bitAdjacentMatrix<T>& matrix) {
+
+            for(size_t i = 0; i < matrix.size(); i++)
+            {
+                for(size_t j = 0; j < matrix.size(); j++)
+                {
+                    os << std::setw(6);
+                    if (matrix.test(i, j)) {
+                        os << matrix.weight(i, j);
+                    } else {
+                        os << 0;
+                    }
+                    os << " ";
+                }
+                os << std::endl;
+            }
+            return os;
+        };
+    };
+
     /**
      * @brief Matrix of size MxN
      * @tparam R number of row
@@ -70,7 +183,7 @@ namespace Matrix {
     template< typename T = int >
     class M {
     protected:
-        T *_m;
+        Aligned::Vector<T> _m;
         /**
          * @brief size of the matrix
          * first = row
@@ -87,18 +200,56 @@ namespace Matrix {
 
         M(const M<T>& other);
 
+        /**
+         * @brief Take the cells of other without copying them, other is left empty
+         */
+        M(M<T>&& other) noexcept;
+
+        /**
+         * @brief A 1 x vec.size() row matrix
+         */
         M(const std::vector<T>& vec);
 
-        M(const T* data);
+        /**
+         * @brief Copy a rows x cols matrix, row-major
+         * @param data -> rows * cols cells
+         */
+        M(const T* data, size_t rows, size_t cols);
 
         M(const Matrix::adjacentMatrix<T>& adjMatrix);
 
+        /**
+         * @brief Evaluate an element-wise expression (see Expression.hpp) in a single pass
+         */
+        template<Expression::Node E>
+        M(const E& expression);
+
         ~M();
 
         s size() const;
 
-        static M power(const M& matrix, int value);
+        /**
+         * @brief The cells, row-major
+         */
+        T *data();
+
+        const T *data() const;
+
+        /**
+         * @brief matrix ^ value by repeated squaring
+         * @param threads -> the number of threads of every product, 0 for one per hardware thread
+         * @tparam S -> the semiring of the products, see Semiring.hpp
+         */
+        template<typename S = Semiring::Plus<T>>
+        static M power(const M& matrix, int value, size_t threads = 1);
 
+        template<typename S = Semiring::Plus<T>>
+        static M power(const M& matrix, int value, ThreadPool &pool);
+
+        /**
+         * @brief The one of the semiring on the diagonal, its zero elsewhere
+         */
+        template<typename S = Semiring::Plus<T>>
         static M identityMatrix(size_t size);
 
         inline T& operator()(size_t row, size_t col);
@@ -114,14 +265,46 @@ namespace Matrix {
 
         M<T> operator*(const M<T> &other) const;
 
-        M operator*(T v);
+        /**
+         * @brief Product over a semiring with the output tiles shared between several threads,
+         * the result does not depend on the number of threads and with Semiring::Plus it is the same as operator*
+         * @param threads -> the number of threads, 0 for one per hardware thread
+         * @tparam S -> the semiring, see Semiring.hpp
+         */
+        template<typename S = Semiring::Plus<T>>
+        M<T> multiply(const M<T> &other, size_t threads = 1) const;
 
-        M operator/(T v);
+        template<typename S = Semiring::Plus<T>>
+        M<T> multiply(const M<T> &other, ThreadPool &pool) const;
 
-        M operator^(T v);
+        /**
+         * @brief Product of two square matrices with Strassen-Winograd, O(n^2.81)
+         * exact for integer types (up to the overflows of the usual product), a little less accurate than operator* for floating ones
+         * @param crossover -> the blocks not larger than crossover are multiplied by the blocked kernel
+         * @param threads -> the number of threads of the 7 products of the first level, 0 for one per hardware thread
+         */
+        M<T> strassen(const M<T> &other, size_t crossover = Strassen::defaultCrossover, size_t threads = 1) const;
+
+        /**
+         * @brief Product of two square matrices with Strassen-Winograd in the memory of an arena,
+         * so a loop of products of the same size only allocates its results
+         * @param arena -> keeps the padded operands and the scratch space of every level until the next product
+         */
+        M<T> strassen(const M<T> &other, Strassen::Arena<T> &arena, size_t crossover = Strassen::defaultCrossover, size_t threads = 1) const;
+
+        /**
+         * @brief res = a * b without allocating, so a loop of products can reuse its buffers
+         * @param res -> a matrix of a.size().row x b.size().col, it must not be a or b
+         */
+        template<typename S = Semiring::Plus<T>>
+        static void product(const M<T> &a, const M<T> &b, M<T> &res, ThreadPool &pool);
 
-        inline M operator+(const M& other) const;
-        inline M operator-(const M& other) const;
+        /**
+         * @brief Exchange the content of two matrices in O(1)
+         */
+        void swap(M<T> &other);
+
+        M operator^(T v);
 
 
         void operator*=(const M<T> &other);
@@ -132,16 +315,34 @@ namespace Matrix {
 
         void operator^=(T v);
 
-        void operator+=(const M& other);
-        void operator-=(const M& other);
+        /**
+         * @brief this = this + other in a single pass, other may be a matrix or an expression
+         */
+        template<Expression::Operand E>
+        void operator+=(const E& other);
 
+        template<Expression::Operand E>
+        void operator-=(const E& other);
+
+        /**
+         * @brief Copy other, this matrix takes its size
+         */
         M& operator=(const M<T> &other);
 
+        M& operator=(M<T> &&other) noexcept;
+
         M& operator=(const T* data_array);
         M& operator=(const std::vector<T>& data_vec);
 
         M& operator=(const Matrix::adjacentMatrix<T>& adjMatrix);
 
+        /**
+         * @brief Evaluate an element-wise expression in a single pass, the matrix is resized to the size of the expression
+         * the expression may read this matrix, e.g. m = m * 2 + other
+         */
+        template<Expression::Node E>
+        M& operator=(const E& expression);
+
         M& operator=(T v);
         void fill(T v);
 
@@ -176,23 +377,23 @@ template<typename T>
 Matrix::M<T>::M() : _m(), _size(0) {}
 
 template<typename T>
-Matrix::M<T>::M(s size) : _size(size) {
-    _m = new T[size.row * size.col];
-    fill(0);
-}
+Matrix::M<T>::M(s size) : _m(size.row * size.col, T(0)), _size(size) {}
 
 template<typename T>
-Matrix::M<T>::M(size_t row, size_t col) : _size(s(row, col)) {
-    _m = new T[row * col];
-    fill(0);
+Matrix::M<T>::M(size_t row, size_t col) : _m(row * col, T(0)), _size(s(row, col)) {}
+
+template<typename T>
+Matrix::M<T>::M(const Matrix::M<T>& other) : _m(other._m), _size(other._size) {}
+
+template<typename T>
+Matrix::M<T>::M(Matrix::M<T>&& other) noexcept : _m(std::move(other._m)), _size(other._size) {
+    other._size = s(0, 0);
 }
 
 template<typename T>
-Matrix::M<T>::M(const Matrix::M<T>& other) : _size(other._size) {
-    _m = new T[other.size().row * other.size().col];
-    for (size_t i = 0; i < other.size().row * other.size().col; i++) {
-        _m[i] = other._m[i];
-    }
+template<Matrix::Expression::Node E>
+Matrix::M<T>::M(const E &expression) : _m(expression.rows() * expression.cols()), _size(s(expression.rows(), expression.cols())) {
+    Expression::evaluate(expression, _m.data());
 }
 
 template<typename T>
@@ -200,6 +401,16 @@ s Matrix::M<T>::size() const {
     return _size;
 }
 
+template<typename T>
+T *Matrix::M<T>::data() {
+    return _m.data();
+}
+
+template<typename T>
+const T *Matrix::M<T>::data() const {
+    return _m.data();
+}
+
 template<typename T>
 T &Matrix::M<T>::operator()(size_t row, size_t col) {
     return at(row, col);
@@ -238,54 +449,65 @@ void Matrix::M<T>::set(size_t row, size_t col, T value) {
 
 template<typename T>
 Matrix::M <T> Matrix::M<T>::operator*(const Matrix::M<T> &other) const {
-    Matrix::M<T> result(this->size().row, other.size().col);
-
-    for (size_t i = 0; i < this->size().row; i++) {
-        for (size_t j = 0; j < other.size().col; j++) {
-            for (size_t k = 0; k < this->size().col; k++) {
-                result(i, j) += at(i, k) * other(k, j);
-            }
-        }
+    if (this->size().col != other.size().row) {
+        throw std::invalid_argument("Matrix::M::operator*() -- incompatible sizes !");
     }
 
+    Matrix::M<T> result(this->size().row, other.size().col);
+    Gemm::multiply(_m.data(), other._m.data(), result._m.data(), this->size().row, this->size().col, other.size().col);
+
     return result;
 }
 
 template<typename T>
-Matrix::M <T> Matrix::M<T>::operator*(T v) {
-    for (size_t i = 0; i < this->size().row; i++) {
-        for (size_t j = 0; j < this->size().col; j++) {
-            at(i, j) *= v;
-        }
-    }
-
-    return *this;
+template<typename S>
+Matrix::M<T> Matrix::M<T>::multiply(const Matrix::M<T> &other, size_t threads) const {
+    ThreadPool pool(threads);
+    return this->multiply<S>(other, pool);
 }
 
 template<typename T>
-Matrix::M <T> Matrix::M<T>::operator+(const Matrix::M<T> &other) const {
-    Matrix::M<T> res(this->size().row, this->size().col);
+template<typename S>
+Matrix::M<T> Matrix::M<T>::multiply(const Matrix::M<T> &other, ThreadPool &pool) const {
+    Matrix::M<T> result(this->size().row, other.size().col);
+    M::product<S>(*this, other, result, pool);
 
-    for (size_t i = 0; i < this->size().row; i++) {
-        for (size_t j = 0; j < this->size().col; j++) {
-            res.at(i, j) = this->at(i, j) + other.at(i, j);
-        }
+    return result;
+}
+
+template<typename T>
+template<typename S>
+void Matrix::M<T>::product(const Matrix::M<T> &a, const Matrix::M<T> &b, Matrix::M<T> &res, ThreadPool &pool) {
+    if (a.size().col != b.size().row || res.size().row != a.size().row || res.size().col != b.size().col) {
+        throw std::invalid_argument("Matrix::M::product() -- incompatible sizes !");
     }
 
-    return res;
+    Gemm::multiply<T, S>(a._m.data(), b._m.data(), res._m.data(), a.size().row, a.size().col, b.size().col, &pool);
 }
 
 template<typename T>
-Matrix::M<T> Matrix::M<T>::operator-(const Matrix::M<T> &other) const {
-    Matrix::M<T> res(this->size().row, this->size().col);
+Matrix::M<T> Matrix::M<T>::strassen(const Matrix::M<T> &other, size_t crossover, size_t threads) const {
+    Strassen::Arena<T> arena;
+    return this->strassen(other, arena, crossover, threads);
+}
 
-    for (size_t i = 0; i < this->size().row; i++) {
-        for (size_t j = 0; j < this->size().col; j++) {
-            res.at(i, j) = this->at(i, j) - other.at(i, j);
-        }
+template<typename T>
+Matrix::M<T> Matrix::M<T>::strassen(const Matrix::M<T> &other, Strassen::Arena<T> &arena, size_t crossover, size_t threads) const {
+    if (this->size().row != this->size().col || other.size().row != other.size().col || this->size().col != other.size().row) {
+        throw std::invalid_argument("Matrix::M::strassen() -- the matrices must be square and of the same size !");
     }
 
-    return res;
+    Matrix::M<T> result(this->size().row, this->size().col);
+    ThreadPool pool(threads);
+    arena.multiply(_m.data(), other._m.data(), result._m.data(), this->size().row, crossover, &pool);
+
+    return result;
+}
+
+template<typename T>
+void Matrix::M<T>::swap(Matrix::M<T> &other) {
+    std::swap(_m, other._m);
+    std::swap(_size, other._size);
 }
 
 template<typename T>
@@ -294,16 +516,8 @@ void Matrix::M<T>::operator*=(const Matrix::M<T> &other) {
         Logger::debug("can't use operator*= with different size matrix");
     }
 
-    Matrix::M<T> temp = *this;
-
-    for (size_t i = 0; i < this->size().row; i++) {
-        for (size_t j = 0; j < this->size().col; j++) {
-            this->set(i, j, 0);
-            for (size_t k = 0; k < this->size().row; k++) {
-                this->at(i, j) += (temp(i, k) * other(k, j));
-            }
-        }
-    }
+    Matrix::M<T> temp = (*this) * other;
+    this->swap(temp);
 }
 
 template<typename T>
@@ -314,27 +528,41 @@ void Matrix::M<T>::operator*=(T v) {
 }
 
 template<typename T>
-void Matrix::M<T>::operator+=(const Matrix::M<T> &other) {
-    for (size_t i = 0; i < this->size().row * this->size().col; i++) {
-        _m[i] += other._m[i];
-    }
+template<Matrix::Expression::Operand E>
+void Matrix::M<T>::operator+=(const E &other) {
+    Expression::evaluate(*this + other, _m.data());
 }
 
 template<typename T>
-void Matrix::M<T>::operator-=(const Matrix::M<T> &other) {
-    for (size_t i = 0; i < this->size().row * this->size().col; i++) {
-        _m[i] -= other._m[i];
-    }
+template<Matrix::Expression::Operand E>
+void Matrix::M<T>::operator-=(const E &other) {
+    Expression::evaluate(*this - other, _m.data());
 }
 
 template<typename T>
 Matrix::M<T>& Matrix::M<T>::operator=(const Matrix::M<T> &other) {
-    for (size_t i = 0; i < this->size().row * this->size().col; i++) {
-        _m[i] = other._m[i];
-    }
+    _m = other._m;
+    _size = other._size;
+    return *this;
+}
 
+template<typename T>
+Matrix::M<T>& Matrix::M<T>::operator=(Matrix::M<T> &&other) noexcept {
+    _m = std::move(other._m);
+    _size = other._size;
+    other._size = s(0, 0);
+    return *this;
+}
 
-    //    memcpy(_m, other._m, sizeof(T) * other.size().row * other.size().col);
+template<typename T>
+template<Matrix::Expression::Node E>
+Matrix::M<T>& Matrix::M<T>::operator=(const E &expression) {
+    if (this->size().row != expression.rows() || this->size().col != expression.cols()) {
+        // the expression cannot read this matrix, it would have its size
+        _size = s(expression.rows(), expression.cols());
+        _m.resize(_size.row * _size.col);
+    }
+    Expression::evaluate(expression, _m.data());
     return *this;
 }
 
@@ -373,11 +601,7 @@ Matrix::M<T> &Matrix::M<T>::operator=(const Matrix::adjacentMatrix<T> &adjMatrix
 
 template<typename T>
 void Matrix::M<T>::fill(T v) {
-    for (size_t i = 0; i < this->size().row; i++) {
-        for (size_t j = 0; j < this->size().col; j++) {
-            at(i, j) = v;
-        }
-    }
+    std::fill(_m.begin(), _m.end(), v);
 }
 
 template<typename T>
@@ -411,15 +635,6 @@ bool Matrix::M<T>::operator!=(Matrix::M<T> other) {
     return !((*this) == other);
 }
 
-template<typename T>
-Matrix::M<T> Matrix::M<T>::operator/(T v) {
-    for (size_t i = 0; i < this->size().row; i++) {
-        for (size_t j = 0; j < this->size().col; j++) {
-            at(i, j) /= v;
-        }
-    }
-}
-
 template<typename T>
 void Matrix::M<T>::operator/=(T v) {
     (*this) = (*this) / v;
@@ -427,24 +642,33 @@ void Matrix::M<T>::operator/=(T v) {
 
 
 template<typename T>
-Matrix::M<T> Matrix::M<T>::power(const Matrix::M<T> &matrix, int value) {
-    if (value == 0) return M::identityMatrix(matrix.size().row);
+template<typename S>
+Matrix::M<T> Matrix::M<T>::power(const Matrix::M<T> &matrix, int value, size_t threads) {
+    ThreadPool pool(threads);
+    return M::power<S>(matrix, value, pool);
+}
+
+template<typename T>
+template<typename S>
+Matrix::M<T> Matrix::M<T>::power(const Matrix::M<T> &matrix, int value, ThreadPool &pool) {
+    if (value == 0) return M::identityMatrix<S>(matrix.size().row);
 
     if (value == 1) return matrix;
 
     if (value % 2 == 0) {
-        return M::power(matrix * matrix, value / 2);
+        return M::power<S>(matrix.multiply<S>(matrix, pool), value / 2, pool);
     } else {
-        return matrix * M::power(matrix * matrix, (value-1) / 2);
+        return matrix.multiply<S>(M::power<S>(matrix.multiply<S>(matrix, pool), (value-1) / 2, pool), pool);
     }
 }
 
 template<typename T>
+template<typename S>
 Matrix::M<T> Matrix::M<T>::identityMatrix(size_t size) {
     Matrix::M<T> temp(size, size);
-    temp.fill(0);
+    temp.fill(S::zero());
     for (size_t i = 0; i < size; i++) {
-        temp(i, i, 1);
+        temp(i, i, S::one());
     }
 
     return temp;
@@ -461,41 +685,33 @@ void Matrix::M<T>::operator^=(T v) {
 }
 
 template<typename T>
-Matrix::M<T>::M(const T *data) : _m() {
-    (*this) = data;
-}
+Matrix::M<T>::M(const T *data, size_t rows, size_t cols) : _m(data, data + rows * cols), _size(s(rows, cols)) {}
 
 template<typename T>
-Matrix::M<T>::M(const Matrix::adjacentMatrix<T> &adjMatrix) {
+Matrix::M<T>::M(const Matrix::adjacentMatrix<T> &adjMatrix) : _m(adjMatrix.size() * adjMatrix.size()), _size(s(adjMatrix.size(), adjMatrix.size())) {
     (*this) = adjMatrix;
 }
 
 template<typename T>
-Matrix::M<T>::M(const std::vector<T> &vec) : _m() {
-    (*this) = vec;
-}
+Matrix::M<T>::M(const std::vector<T> &vec) : _m(vec.begin(), vec.end()), _size(s(1, vec.size())) {}
 
 template<typename T>
-Matrix::M<T>::~M() {}
+Matrix::M<T>::~M() = default;
 
 template<typename T>
-Matrix::adjacentMatrix<T>::adjacentMatrix(size_t size) : _size(size) {
-    _m = new std::pair<T, T>[size * size];
-    for (size_t i = 0; i < size; i++) {
-        for (size_t j = 0; j < size; j++) {
-            at(i, j) = std::make_pair(0, 0);
-        }
-    }
-}
+Matrix::adjacentMatrix<T>::adjacentMatrix(size_t size) : _m(size * size, std::make_pair(T(0), T(0))), _size(size) {}
 
 template<typename T>
-Matrix::adjacentMatrix<T>::adjacentMatrix(const std::pair<T, T> *data) {
-    (*this) = data;
-}
+Matrix::adjacentMatrix<T>::adjacentMatrix(const std::pair<T, T> *data, size_t size) : _m(data, data + size * size), _size(size) {}
 
 template<typename T>
-Matrix::adjacentMatrix<T>::adjacentMatrix(const std::vector<std::pair<T, T>> &vec) {
-    (*this) = vec;
+Matrix::adjacentMatrix<T>::adjacentMatrix(const std::vector<std::pair<T, T>> &vec) : _m(vec.begin(), vec.end()), _size(0) {
+    while (_size * _size < vec.size()) {
+        _size++;
+    }
+    if (_size * _size != vec.size()) {
+        throw std::invalid_argument("Matrix::adjacentMatrix() -- the number of cells is not a square !");
+    }
 }
 
 template<typename T>
@@ -517,8 +733,26 @@ void Matrix::adjacentMatrix<T>::operator()(size_t row, size_t col, std::pair<T,
 }
 
 template<typename T>
-Matrix::adjacentMatrix<T>::adjacentMatrix(const Matrix::adjacentMatrix<T> &other) {
-    (*this) = other;
+Matrix::adjacentMatrix<T>::adjacentMatrix(const Matrix::adjacentMatrix<T> &other) : _m(other._m), _size(other._size) {}
+
+template<typename T>
+Matrix::adjacentMatrix<T>::adjacentMatrix(Matrix::adjacentMatrix<T> &&other) noexcept : _m(std::move(other._m)), _size(other._size) {
+    other._size = 0;
+}
+
+template<typename T>
+Matrix::adjacentMatrix<T> &Matrix::adjacentMatrix<T>::operator=(const Matrix::adjacentMatrix<T> &other) {
+    _m = other._m;
+    _size = other._size;
+    return *this;
+}
+
+template<typename T>
+Matrix::adjacentMatrix<T> &Matrix::adjacentMatrix<T>::operator=(Matrix::adjacentMatrix<T> &&other) noexcept {
+    _m = std::move(other._m);
+    _size = other._size;
+    other._size = 0;
+    return *this;
 }
 
 template<typename T>
@@ -546,3 +780,119 @@ template<typename T>
 size_t Matrix::adjacentMatrix<T>::size() const {
     return _size;
 }
+
+template<typename T>
+Matrix::bitAdjacentMatrix<T>::bitAdjacentMatrix(size_t size) : _size(size), _words((size + 63) / 64), _bits(size * ((size + 63) / 64), 0), _weights(weighted ? size : 0) {}
+
+template<typename T>
+size_t Matrix::bitAdjacentMatrix<T>::size() const {
+    return _size;
+}
+
+template<typename T>
+size_t Matrix::bitAdjacentMatrix<T>::words() const {
+    return _words;
+}
+
+template<typename T>
+const uint64_t *Matrix::bitAdjacentMatrix<T>::row(size_t row) const {
+    return _bits.data() + row * _words;
+}
+
+template<typename T>
+bool Matrix::bitAdjacentMatrix<T>::test(size_t row, size_t col) const {
+    return (_bits[row * _words + col / 64] >> (col % 64)) & 1;
+}
+
+template<typename T>
+size_t Matrix::bitAdjacentMatrix<T>::rank(size_t row, size_t col) const {
+    const uint64_t *words = this->row(row);
+    size_t res = 0;
+    for (size_t i = 0; i < col / 64; i++) {
+        res += std::popcount(words[i]);
+    }
+    return res + std::popcount(words[col / 64] & ((uint64_t(1) << (col % 64)) - 1));
+}
+
+template<typename T>
+T Matrix::bitAdjacentMatrix<T>::weight(size_t row, size_t col) const {
+    if constexpr (weighted) {
+        if (!_weights[row].empty()) {
+            return _weights[row][rank(row, col)];
+        }
+    }
+    return 1;
+}
+
+template<typename T>
+T Matrix::bitAdjacentMatrix<T>::weightOf(size_t row, size_t k) const {
+    if constexpr (weighted) {
+        if (!_weights[row].empty()) {
+            return _weights[row][k];
+        }
+    }
+    return 1;
+}
+
+template<typename T>
+size_t Matrix::bitAdjacentMatrix<T>::count(size_t row) const {
+    size_t res = 0;
+    for (const uint64_t *word = this->row(row), *end = word + _words; word != end; word++) {
+        res += std::popcount(*word);
+    }
+    return res;
+}
+
+template<typename T>
+std::pair<int, T> Matrix::bitAdjacentMatrix<T>::operator()(size_t row, size_t col) const {
+    return at(row, col);
+}
+
+template<typename T>
+void Matrix::bitAdjacentMatrix<T>::operator()(size_t row, size_t col, std::pair<int, T> value) {
+    set(row, col, value);
+}
+
+template<typename T>
+std::pair<int, T> Matrix::bitAdjacentMatrix<T>::at(size_t row, size_t col) const {
+    if (row >= this->size() || col >= this->size()) {
+        throw std::out_of_range("Matrix::bitAdjacentMatrix::at() -- index out of range !");
+    }
+    if (!test(row, col)) {
+        return {0, T(0)};
+    }
+    return {1, weight(row, col)};
+}
+
+template<typename T>
+void Matrix::bitAdjacentMatrix<T>::set(size_t row, size_t col, const std::pair<int, T> &value) {
+    uint64_t &word = _bits[row * _words + col / 64];
+    uint64_t bit = uint64_t(1) << (col % 64);
+    bool present = word & bit;
+
+    if (value.first == 0) {
+        if constexpr (weighted) {
+            if (present && !_weights[row].empty()) {
+                _weights[row].erase(_weights[row].begin() + rank(row, col));
+            }
+        }
+        word &= ~bit;
+        return;
+    }
+
+    word |= bit;
+    if constexpr (weighted) {
+        std::vector<T> &weights = _weights[row];
+        if (weights.empty() && value.second == 1) {
+            return;
+        }
+        if (weights.empty()) {
+            // first weight of the row that is not 1
+            weights.assign(count(row), 1);
+        } else if (!present) {
+            weights.insert(weights.begin() + rank(row, col), value.second);
+            return;
+        }
+        weights[rank(row, col)] = value.second;
+    }
+}
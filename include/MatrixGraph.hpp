@@ -1,34 +1,145 @@
 #pragma once
 
 #include "Matrix.hpp"
+#include "BoolMatrix.hpp"
+#include "FloydWarshall.hpp"
 #include "Logger.hpp"
+#include "ParallelBFS.hpp"
+#include "ShortestPath.hpp"
+#include "TraversalWorkspace.hpp"
+#include "Eccentricity.hpp"
+#include "DepthFirstSearch.hpp"
 
 #include <optional>
+#include <span>
 #include <random>
 #include <iostream>
 #include <queue>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
 
 namespace Matrix {
-    template<typename T>
-    class Graph : public adjacentMatrix<T> {
+    /**
+     * @brief Non owning view over the neighbours of a vertex, the set bits of its row are found a 64 bits word at a time
+     * an element is std::pair(neighbour, weight)
+     * @tparam T the vertex ids, W the weights
+     */
+    template<typename T, typename W = T>
+    class Neighbours {
+    private:
+        const bitAdjacentMatrix<W> *_matrix;
+        size_t _row;
+
+    public:
+        class iterator {
+        private:
+            const bitAdjacentMatrix<W> *_matrix = nullptr;
+            size_t _row = 0;
+            size_t _word = 0;
+            size_t _rank = 0;
+            uint64_t _bits = 0;
+
+            void skipEmpty() {
+                while (this->_bits == 0 && ++this->_word < this->_matrix->words()) {
+                    this->_bits = this->_matrix->row(this->_row)[this->_word];
+                }
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::pair<T, W>;
+            using difference_type = std::ptrdiff_t;
+            using reference = value_type;
+            using pointer = void;
+
+            iterator() = default;
+
+            iterator(const bitAdjacentMatrix<W> *matrix, size_t row, size_t word) : _matrix(matrix), _row(row), _word(word) {
+                if (this->_word < this->_matrix->words()) {
+                    this->_bits = this->_matrix->row(this->_row)[this->_word];
+                    this->skipEmpty();
+                }
+            }
+
+            value_type operator*() const {
+                size_t col = this->_word * 64 + std::countr_zero(this->_bits);
+                return {T(col), this->_matrix->weightOf(this->_row, this->_rank)};
+            }
+
+            iterator &operator++() {
+                this->_bits &= this->_bits - 1;
+                this->_rank++;
+                this->skipEmpty();
+                return *this;
+            }
+
+            iterator operator++(int) {
+                iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            bool operator==(const iterator &other) const {
+                return this->_word == other._word && this->_bits == other._bits;
+            }
+        };
+
+        Neighbours(const bitAdjacentMatrix<W> *matrix, size_t row) : _matrix(matrix), _row(row) {}
+
+        [[nodiscard]] iterator begin() const {
+            return iterator(this->_matrix, this->_row, 0);
+        }
+
+        [[nodiscard]] iterator end() const {
+            return iterator(this->_matrix, this->_row, this->_matrix->words());
+        }
+
+        [[nodiscard]] bool empty() const {
+            return this->begin() == this->end();
+        }
+    };
+
+    /**
+     * @tparam T the vertex ids
+     * @tparam W the weights of the edges, void for an unweighted graph whose matrix only holds the bits
+     * @tparam D the distances, the weights by default, a signed number of edges for an unweighted graph
+     */
+    template<typename T, typename W = T, typename D = Type::DistanceOf<T, W>>
+    class Graph : public bitAdjacentMatrix<Type::WeightOf<W>> {
+    public:
+        using Vertex = T;
+        using Weight = Type::WeightOf<W>;
+
     private:
         Type::Graph _d;
         size_t _size;
+        Weight _minWeight = 0;
+        Weight _maxWeight = 0;
 
     protected:
-        void BFSVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &res);
+        void BFSVisit(T v, std::vector<uint64_t> &unvisited, std::vector<uint64_t> &found, std::vector<T> &parent, std::vector<T> &res);
+
+        void BFSVisit(T v, TraversalWorkspace<T, D> &workspace);
+
+        bool nextNeighbour(T v, size_t &next, T &z, const uint64_t *mask = nullptr) const;
 
-        void DFSVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &res, Type::Print type);
+        std::vector<uint64_t> allVertices() const;
 
-        bool cycleVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &cycle, T prev);
+        /**
+         * @brief DFS cursor over the neighbours not reached yet, v and the returned vertex are removed from unvisited
+         * so a dense DFS only reads O(n * n / 64) words
+         */
+        auto nextUnvisitedNeighbour(std::vector<uint64_t> &unvisited) const;
 
-        void distanceFromSourceVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &distance);
+        void distanceFromSourceVisit(T v, std::vector<T> &parent, std::vector<D> &distance);
+
+        void distanceFromSourceVisit(T v, TraversalWorkspace<T, D> &workspace);
 
         bool isBipartiteVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<Color> &partie);
 
-        void longestPathVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::pair<T, std::pair<T, T>> &lPath, std::pair<T, std::pair<T, T>> actualPath, T previous);
+        bool isBipartiteVisit(T v, TraversalWorkspace<T, D> &workspace);
 
-        std::optional<std::pair<T, std::vector<T>>> pathVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::pair<T, std::vector<T>> path, std::pair<T, T> &param);
 
     public:
         Graph();
@@ -38,7 +149,7 @@ namespace Matrix {
          * @param n -> the size of the graph
          * @param directed -> the type of the graph DIRECTED or UNDIRECTED, default UNDIRECTED
          */
-        Graph(int size, Type::Graph directed = Type::Graph::UNDIRECTED);
+        Graph(size_t size, Type::Graph directed = Type::Graph::UNDIRECTED);
 
         /**
          * @brief Create a graph from a matrix
@@ -46,6 +157,15 @@ namespace Matrix {
          */
         Graph(const Graph& graph);
 
+        /**
+         * @brief Take the matrix of graph without copying it, graph is left empty
+         */
+        Graph(Graph&& graph) noexcept;
+
+        Graph& operator=(const Graph& graph);
+
+        Graph& operator=(Graph&& graph) noexcept;
+
         /**
          * @brief Create a random graph
          * @param numberOfVertices -> the number of vertices
@@ -54,17 +174,17 @@ namespace Matrix {
          * @param includeRandomWeight -> if true the weight of the edge will be random, default false
          * @return the random graph
          */
-        static Graph createRandomGraph(int numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, double edgeProbability = 0.5, bool includeRandomWeight = false);
+        static Graph createRandomGraph(size_t numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, double edgeProbability = 0.5, bool includeRandomWeight = false);
 
-        static Graph<T> createCycleGraph(int numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false);
+        static Graph createCycleGraph(size_t numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false);
 
-        static Graph<T> createBlackHoleGraph(int numberOfVertices, Type::Graph directed = Type::Graph::DIRECTED, bool includeRandomWeight = false, T blackHole = 0);
+        static Graph createBlackHoleGraph(size_t numberOfVertices, Type::Graph directed = Type::Graph::DIRECTED, bool includeRandomWeight = false, T blackHole = 0);
 
-        static Graph<T> createCompleteGraph(int numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false);
+        static Graph createCompleteGraph(size_t numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false);
 
-        static Graph<T> createBipartiteGraph(int numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false);
+        static Graph createBipartiteGraph(size_t numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false);
 
-        static Graph<T> createStarGraph(int numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false);
+        static Graph createStarGraph(size_t numberOfVertices, Type::Graph directed = Type::Graph::UNDIRECTED, bool includeRandomWeight = false);
 
         ~Graph();
 
@@ -78,7 +198,7 @@ namespace Matrix {
          * @param to -> the ending point
          * @param weight -> the weight of the edge
          */
-        void addEdge(T from, T to, T weight = 1);
+        void addEdge(T from, T to, Weight weight = 1);
 
         /**
          * @brief Remove an edge from the graph (hard complexity so use it carefully)
@@ -101,12 +221,50 @@ namespace Matrix {
         std::vector<T> BFS(T start = 0);
 
         /**
-         * @brief Get the DFS of the graph
+         * @brief Get the BFS of the graph without allocating, in the memory of a workspace
+         * @param start -> the starting vertex
+         * @param workspace -> holds the order, the parents and the number of edges from the root of each vertex until its next run
+         * @return the BFS, valid until the next run of the workspace
+         */
+        std::span<const T> BFS(T start, TraversalWorkspace<T, D> &workspace);
+
+        /**
+         * @brief Get the BFS of the graph, every level being expanded by several threads
+         * @param start -> the starting vertex
+         * @param threads -> the number of threads, 0 for one per hardware thread
+         * @return a vector of the BFS, level after level (the order inside a level depends on the threads)
+         */
+        std::vector<T> parallelBFS(T start = 0, size_t threads = 0);
+
+        /**
+         * @brief Get the BFS tree of a vertex, every level being expanded by several threads
+         * @param v -> the root of the tree
+         * @param threads -> the number of threads, 0 for one per hardware thread
+         * @return std::pair(number of edges from v, parent in the tree), -1 for the vertices not reached
+         */
+        std::pair<std::vector<D>, std::vector<T>> parallelBFSTree(T v, size_t threads = 0);
+
+        /**
+         * @brief Get the DFS of the graph, with an explicit stack so deep graphs are safe
          * @param type PREORDER or POSTORDER
          * @return a vector of the DFS
          */
         std::vector<T> DFS(T start = 0, Type::Print type = Type::Print::PREORDER);
 
+        /**
+         * @brief Get the DFS of the graph without allocating, in the memory of a workspace
+         * @param type PREORDER or POSTORDER
+         * @return the DFS, valid until the next query on the workspace
+         */
+        std::span<const T> DFS(T start, Type::Print type, TraversalWorkspace<T, D> &workspace);
+
+        /**
+         * @brief Get the whole DFS forest: preorder, postorder, parents, discovery and finish times
+         * @param start -> the first root, the other roots are taken in increasing order
+         * @return the DepthFirst::Tree
+         */
+        DepthFirst::Tree<T> DFSTree(T start = 0) const;
+
         /**
          * @brief Check if the graph is bipartite
          * @return true if the graph is bipartite else false
@@ -114,8 +272,14 @@ namespace Matrix {
         bool isBipartite();
 
         /**
-         * @brief Check if the graph has a cycle
-         * @return a vector of edges of the cycle if exist else nothing
+         * @brief Check if the graph is bipartite without allocating, a side is the parity of the BFS level
+         * @return true if the graph is bipartite else false
+         */
+        bool isBipartite(TraversalWorkspace<T, D> &workspace);
+
+        /**
+         * @brief Find a cycle in O(n + m), a directed graph only follows the direction of its edges
+         * @return the vertices of a cycle, the first one repeated at the end, if one exists else nothing
          */
         std::optional<std::vector<T>> cycle();
 
@@ -126,32 +290,45 @@ namespace Matrix {
         bool eulerianCycle();
 
         /**
-         * @brief distance from any vertex
+         * @brief Shortest distance from any vertex (Dijkstra, the weights must not be negative)
          * @param v -> the vertex
-         * @return a vector of the distance from v
+         * @return a vector of the distance from v, -1 if not reachable
          */
-        std::vector<T> distanceFrom(T v);
+        std::vector<D> distanceFrom(T v);
+
+        /**
+         * @brief Shortest distance from any vertex without allocating
+         * @param v -> the vertex
+         * @param workspace -> workspace.distance(w) and workspace.parent(w) hold the result until its next run
+         */
+        void distanceFrom(T v, TraversalWorkspace<T, D> &workspace);
 
         /**
          * @brief Distance from 0
          * @return a vector of the distance from 0
          */
-        std::vector<T> distanceFromSource();
+        std::vector<D> distanceFromSource();
 
         /**
          * @brief Return the longest path
          * @return std::pair(length of the path, std::pair(from, to))
-         * work with a directed graph without cycle (DAG)
+         * work with a directed graph without cycle (DAG), dynamic programming over the DFS postorder
          */
         std::pair<T, std::pair<T, T>> longestPath();
 
         /**
-         * @brief Return the longest path
+         * @brief Return a path found by a DFS from the starting point
          * @param from -> the starting point
          * @param to -> the ending point
          * @return std::pair(length of the path, std::vector(vertices of the path))
          */
-        std::optional<std::pair<T, std::vector<T>>> path(T from, T to);
+        std::optional<std::pair<D, std::vector<T>>> path(T from, T to);
+
+        /**
+         * @brief Return the path of path(from, to) without allocating
+         * @return std::pair(length of the path, vertices of the path), valid until the next query on the workspace
+         */
+        std::optional<std::pair<D, std::span<const T>>> path(T from, T to, TraversalWorkspace<T, D> &workspace);
 
         /**
          * @brief Check if any vertex is a black hole
@@ -164,58 +341,162 @@ namespace Matrix {
          * @param v -> the vertex
          * @return std::pair(distance, longest vertex)
          */
-        std::optional<std::pair<T, T>> eccentricity(T v);
+        std::optional<std::pair<D, T>> eccentricity(T v);
+
+        /**
+         * @brief Get the eccentricity of a vertex without allocating
+         * @return std::pair(distance, longest vertex)
+         */
+        std::optional<std::pair<D, T>> eccentricity(T v, TraversalWorkspace<T, D> &workspace);
 
         /**
          * @brief Get the radius of the graph
          * @return std::pair(distance, std::pair(from, to))
-         * NOT linear complexity
+         * exact, most vertices are pruned with eccentricity bounds on undirected graphs
          */
-        std::optional<std::pair<T, std::pair<T, T>>> radius();
+        std::optional<std::pair<D, std::pair<T, T>>> radius();
 
         /**
          * @brief Get the diameter of the graph
          * @return std::pair(distance, std::pair(from, to))
-         * NOT linear complexity
+         * exact, most vertices are pruned with eccentricity bounds on undirected graphs
          */
-        std::optional<std::pair<T, std::pair<T, T>>> diameter();
+        std::optional<std::pair<D, std::pair<T, T>>> diameter();
 
-        M<T> matrixPath(T lenght);
+        /**
+         * @brief The adjacency matrix, 1 for an edge else 0
+         * @tparam C the cells, the distances by default
+         */
+        template<typename C = D>
+        M<C> toMatrix() const;
 
-        M<T> matrixAllPath();
+        /**
+         * @brief Number of walks of lenght edges between every pair of vertices
+         * @param threads -> the number of threads of the products, 0 for one per hardware thread
+         * @tparam C the counts, the distances by default, S the semiring of the products, Semiring::ModCount keeps them modulo a prime
+         */
+        template<typename C = D, typename S = Semiring::Plus<C>>
+        M<C> matrixPath(size_t lenght, size_t threads = 1);
 
-        std::vector<std::pair<T, T>> operator[](T vertex) const;
+        /**
+         * @brief Number of walks of 1 to n - 1 edges between every pair of vertices, A + A^2 + ... + A^(n-1)
+         * the running power is multiplied by A once per lenght, in buffers allocated once
+         * @param untilStable -> stop at the first lenght that reaches no new pair, the zero cells are then the same
+         * as the full sum (the reachable pairs cannot change anymore) but the counts only cover the walks up to that lenght
+         * @param threads -> the number of threads of the products, 0 for one per hardware thread
+         * @tparam C the counts, the distances by default, S the semiring of the products and of the sum
+         */
+        template<typename C = D, typename S = Semiring::Plus<C>>
+        M<C> matrixAllPath(bool untilStable = false, size_t threads = 1);
+
+        /**
+         * @brief Shortest distance between every pair of vertices by repeated min-plus squaring of the weight matrix,
+         * O(n^3 log n) on the blocked kernel, it stops as soon as a squaring changes nothing
+         * the weights may be negative if there is no negative cycle
+         * @param threads -> the number of threads of the products, 0 for one per hardware thread
+         * @return distance(i, j), -1 if j is not reachable from i
+         */
+        M<D> allPairsDistances(size_t threads = 1) const;
+
+        /**
+         * @brief Shortest distance between every pair of vertices with a blocked Floyd-Warshall, O(n^3)
+         * the weights may be negative if there is no negative cycle
+         * @param nextHop -> also compute the next hop matrix
+         * @param threads -> the number of threads, 0 for one per hardware thread
+         * @return std::pair(distance(i, j) or -1 if j is not reachable from i, next(i, j) the vertex after i on a shortest path to j or -1)
+         */
+        std::pair<M<D>, std::optional<M<D>>> floydWarshall(bool nextHop = false, size_t threads = 1) const;
+
+        /**
+         * @brief The vertices of a shortest path from a next hop matrix of floydWarshall
+         * @return the path from -> to, empty if to is not reachable
+         */
+        static std::vector<T> nextHopPath(const M<D> &next, T from, T to);
+
+        /**
+         * @brief The adjacency matrix as packed boolean rows, a copy of the bits of the graph
+         */
+        BoolMatrix toBoolMatrix() const;
+
+        /**
+         * @brief (i, j) is true if there is a walk of exactly lenght edges from i to j, without counting the walks
+         */
+        BoolMatrix reachability(T lenght) const;
+
+        /**
+         * @brief (i, j) is true if j can be reached from i by at least one edge
+         * squares R | R * R until it stops changing, so O(log n) boolean products at most
+         */
+        BoolMatrix transitiveClosure() const;
+
+        /**
+         * @brief Neighbours of a vertex, nothing is copied
+         * @param vertex -> the vertex
+         * @return a view of std::pair(neighbour, weight)
+         */
+        Neighbours<T, Weight> operator[](T vertex) const;
     };
 }
 
-template<typename T>
-Matrix::Graph<T>::Graph() : adjacentMatrix<T>(size_t(0)), _size(0), _d(Type::Graph::UNDIRECTED) {}
+template<typename T, typename W, typename D>
+Matrix::Graph<T, W, D>::Graph() : bitAdjacentMatrix<Weight>(size_t(0)), _size(0), _d(Type::Graph::UNDIRECTED) {}
 
-template<typename T>
-Matrix::Graph<T>::Graph(int size, Type::Graph directed) : adjacentMatrix<T>(size), _d(directed), _size(size) {
+template<typename T, typename W, typename D>
+Matrix::Graph<T, W, D>::Graph(size_t size, Type::Graph directed) : bitAdjacentMatrix<Weight>(size), _d(directed), _size(size) {
     Logger::debug("Create a graph of size " + std::to_string(size) + " and type " + std::to_string(directed));
 }
 
-template<typename T>
-Matrix::Graph<T>::Graph(const Graph &graph) : adjacentMatrix<T>(graph), _d(graph._d), _size(graph._size) {
+template<typename T, typename W, typename D>
+Matrix::Graph<T, W, D>::Graph(const Graph &graph) : bitAdjacentMatrix<Weight>(graph), _d(graph._d), _size(graph._size), _minWeight(graph._minWeight), _maxWeight(graph._maxWeight) {
     Logger::debug("Create a graph from copy");
 }
 
-template<typename T>
-Matrix::Graph<T>::~Graph() {
+template<typename T, typename W, typename D>
+Matrix::Graph<T, W, D>::Graph(Graph &&graph) noexcept : bitAdjacentMatrix<Weight>(std::move(graph)), _d(graph._d), _size(graph._size), _minWeight(graph._minWeight), _maxWeight(graph._maxWeight) {
+    static_cast<bitAdjacentMatrix<Weight> &>(graph) = bitAdjacentMatrix<Weight>(size_t(0));
+    graph._size = 0;
+}
+
+template<typename T, typename W, typename D>
+Matrix::Graph<T, W, D> &Matrix::Graph<T, W, D>::operator=(const Graph &graph) {
+    bitAdjacentMatrix<Weight>::operator=(graph);
+    _d = graph._d;
+    _size = graph._size;
+    _minWeight = graph._minWeight;
+    _maxWeight = graph._maxWeight;
+    return *this;
+}
+
+template<typename T, typename W, typename D>
+Matrix::Graph<T, W, D> &Matrix::Graph<T, W, D>::operator=(Graph &&graph) noexcept {
+    bitAdjacentMatrix<Weight>::operator=(std::move(graph));
+    _d = graph._d;
+    _size = graph._size;
+    _minWeight = graph._minWeight;
+    _maxWeight = graph._maxWeight;
+    static_cast<bitAdjacentMatrix<Weight> &>(graph) = bitAdjacentMatrix<Weight>(size_t(0));
+    graph._size = 0;
+    return *this;
+}
+
+template<typename T, typename W, typename D>
+Matrix::Graph<T, W, D>::~Graph() {
     Logger::debug("Delete a graph");
 }
 
-template<typename T>
-void Matrix::Graph<T>::addEdge(T from, T to, T weight) {
+template<typename T, typename W, typename D>
+void Matrix::Graph<T, W, D>::addEdge(T from, T to, Weight weight) {
     this->set(from, to, std::make_pair(1, weight));
     if (this->_d == Type::Graph::UNDIRECTED) {
         this->set(to, from, std::make_pair(1, weight));
     }
+
+    this->_minWeight = std::min(this->_minWeight, weight);
+    this->_maxWeight = std::max(this->_maxWeight, weight);
 }
 
-template<typename T>
-void Matrix::Graph<T>::removeEdge(T from, T to) {
+template<typename T, typename W, typename D>
+void Matrix::Graph<T, W, D>::removeEdge(T from, T to) {
     Logger::debug("Remove edge from " + std::to_string(from) + " to " + std::to_string(to));
     this->set(from, to, std::make_pair(0, 0));
     if (this->_d == Type::Graph::UNDIRECTED) {
@@ -223,102 +504,232 @@ void Matrix::Graph<T>::removeEdge(T from, T to) {
     }
 }
 
-template<typename T>
-T Matrix::Graph<T>::degres(T vertex) {
+template<typename T, typename W, typename D>
+T Matrix::Graph<T, W, D>::degres(T vertex) {
     if (vertex < 0 || vertex > this->size()) {
         throw std::invalid_argument("'edge' must be between 0 and the size of the graph !");
     }
 
-    T res = 0;
-    for (size_t i = 0; i < this->size(); i++) {
-        if (this->operator()(vertex, i).first == 1) {
-            res++;
-        }
-    }
-
-    return res;
+    return T(this->count(size_t(vertex)));
 }
 
-template<typename T>
-std::vector<T> Matrix::Graph<T>::BFS(T start) {
+template<typename T, typename W, typename D>
+std::vector<T> Matrix::Graph<T, W, D>::BFS(T start) {
     Logger::debug("BFS algorithm starting...");
 
-    std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
+    std::vector<uint64_t> unvisited = this->allVertices();
+    std::vector<uint64_t> found(this->words());
     std::vector<T> parent = std::vector<T>(this->size(), -1);
     std::vector<T> res;
+    res.reserve(this->size());
 
-    this->BFSVisit(start, color, parent, res);
+    this->BFSVisit(start, unvisited, found, parent, res);
     for (size_t v = 0; v < this->size(); v++) {
-        if (color[v] == Color::BLUE) {
-            this->BFSVisit(v, color, parent, res);
+        if ((unvisited[v / 64] >> (v % 64)) & 1) {
+            this->BFSVisit(T(v), unvisited, found, parent, res);
         }
     }
 
     return res;
 }
 
-template<typename T>
-void Matrix::Graph<T>::BFSVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &res) {
-    std::queue<T> q;
-    color[v] = Color::WHITE;
-    q.push(v);
-    while (!q.empty()) {
-        int w = q.front();
-        q.pop();
-        for (size_t z = 0; z < this->size(); z++) {
-            if (this->at(v, z).first == 1) {
-                if (color[z] == Color::BLUE) {
-                    color[z] = Color::WHITE;
-                    parent[z] = w;
-                    q.push(z);
-                }
+template<typename T, typename W, typename D>
+std::span<const T> Matrix::Graph<T, W, D>::BFS(T start, TraversalWorkspace<T, D> &workspace) {
+    workspace.reset(this->size());
+
+    this->BFSVisit(start, workspace);
+    for (size_t v = 0; v < this->size(); v++) {
+        if (!workspace.reached(T(v))) {
+            this->BFSVisit(T(v), workspace);
+        }
+    }
+
+    return workspace.order();
+}
+
+template<typename T, typename W, typename D>
+void Matrix::Graph<T, W, D>::BFSVisit(T v, TraversalWorkspace<T, D> &workspace) {
+    // the order is the queue, the vertices from head are still to be expanded
+    size_t head = workspace.order().size();
+    workspace.reach(v, 0, -1);
+    while (head < workspace.order().size()) {
+        T w = workspace.order()[head++];
+        for (auto [z, weight] : (*this)[w]) {
+            if (!workspace.reached(z)) {
+                workspace.reach(z, workspace.distance(w) + 1, w);
             }
         }
-        color[w] = Color::RED;
-        res.push_back(w);
     }
 }
 
-template<typename T>
-std::vector<T> Matrix::Graph<T>::DFS(T start, Type::Print type) {
-    Logger::debug("DFS algorithm starting...");
+template<typename T, typename W, typename D>
+void Matrix::Graph<T, W, D>::BFSVisit(T v, std::vector<uint64_t> &unvisited, std::vector<uint64_t> &found, std::vector<T> &parent, std::vector<T> &res) {
+    const size_t words = this->words();
+    unvisited[size_t(v) / 64] &= ~(uint64_t(1) << (size_t(v) % 64));
+
+    // res is the queue, the vertices in [head, res.size()) are still to be expanded
+    size_t head = res.size();
+    res.push_back(v);
+    while (head < res.size()) {
+        T w = res[head++];
+        const uint64_t *row = this->row(size_t(w));
+
+        // plain word loops so the compiler can vectorize them
+        uint64_t any = 0;
+        for (size_t i = 0; i < words; i++) {
+            found[i] = row[i] & unvisited[i];
+            any |= found[i];
+        }
+        if (any == 0) {
+            continue;
+        }
+        for (size_t i = 0; i < words; i++) {
+            unvisited[i] &= ~found[i];
+        }
 
-    std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
+        for (size_t i = 0; i < words; i++) {
+            for (uint64_t bits = found[i]; bits != 0; bits &= bits - 1) {
+                size_t z = i * 64 + std::countr_zero(bits);
+                parent[z] = w;
+                res.push_back(T(z));
+            }
+        }
+    }
+}
+
+template<typename T, typename W, typename D>
+std::vector<T> Matrix::Graph<T, W, D>::parallelBFS(T start, size_t threads) {
+    Logger::debug("Parallel BFS algorithm starting...");
+
+    ThreadPool pool(threads);
+    std::vector<std::atomic<bool>> visited(this->size());
     std::vector<T> parent = std::vector<T>(this->size(), -1);
+    std::vector<D> distance = std::vector<D>(this->size(), -1);
     std::vector<T> res;
+    res.reserve(this->size());
 
-    this->DFSVisit(start, color, parent, res, type);
+    auto forEachNeighbour = [this](T w, auto &&f) {
+        for (auto [z, weight] : (*this)[w]) {
+            f(z);
+        }
+    };
+
+    Parallel::levelSynchronousBFS(start, visited, parent, distance, res, pool, forEachNeighbour);
     for (size_t v = 0; v < this->size(); v++) {
-        if (color[v] == Color::BLUE) {
-            this->DFSVisit(v, color, parent, res, type);
+        if (!visited[v].load(std::memory_order_relaxed)) {
+            Parallel::levelSynchronousBFS(T(v), visited, parent, distance, res, pool, forEachNeighbour);
         }
     }
+
     return res;
 }
 
-template<typename T>
-void Matrix::Graph<T>::DFSVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &res,
-                                Type::Print type) {
-    color[v] = Color::WHITE;
-    if (type == Type::Print::PREORDER) {
-        res.push_back(v);
-    }
-    for (size_t w = 0; w < this->size(); w++) {
-        if (this->operator()(v, w).first == 0) {
-            if (color[w] == Color::BLUE) {
-                parent[w] = v;
-                this->DFSVisit(w, color, parent, res, type);
-            }
+template<typename T, typename W, typename D>
+std::pair<std::vector<D>, std::vector<T>> Matrix::Graph<T, W, D>::parallelBFSTree(T v, size_t threads) {
+    Logger::debug("Parallel BFS tree from " + std::to_string(v) + " algorithm starting...");
+
+    ThreadPool pool(threads);
+    std::vector<std::atomic<bool>> visited(this->size());
+    std::vector<T> parent = std::vector<T>(this->size(), -1);
+    std::vector<D> distance = std::vector<D>(this->size(), -1);
+    std::vector<T> res;
+
+    Parallel::levelSynchronousBFS(v, visited, parent, distance, res, pool, [this](T w, auto &&f) {
+        for (auto [z, weight] : (*this)[w]) {
+            f(z);
+        }
+    });
+
+    return {distance, parent};
+}
+
+template<typename T, typename W, typename D>
+std::vector<T> Matrix::Graph<T, W, D>::DFS(T start, Type::Print type) {
+    Logger::debug("DFS algorithm starting...");
+
+    std::vector<uint64_t> unvisited = this->allVertices();
+    DepthFirst::OrderVisitor<T> visitor(type);
+    visitor.res.reserve(this->size());
+    DepthFirst::forest(this->size(), start, this->nextUnvisitedNeighbour(unvisited), visitor);
+
+    return visitor.res;
+}
+
+template<typename T, typename W, typename D>
+std::span<const T> Matrix::Graph<T, W, D>::DFS(T start, Type::Print type, TraversalWorkspace<T, D> &workspace) {
+    workspace.reset(this->size());
+
+    // the visitor borrows the memory of the buffer and gives it back
+    DepthFirst::OrderVisitor<T> visitor(type);
+    visitor.res = std::move(workspace.buffer());
+    visitor.res.clear();
+    DepthFirst::forest(this->size(), start, workspace, workspace.stack(), [this](T v, size_t &next, T &z) {
+        return this->nextNeighbour(v, next, z);
+    }, visitor);
+    workspace.buffer() = std::move(visitor.res);
+
+    return workspace.buffer();
+}
+
+template<typename T, typename W, typename D>
+DepthFirst::Tree<T> Matrix::Graph<T, W, D>::DFSTree(T start) const {
+    Logger::debug("DFS tree algorithm starting...");
+
+    std::vector<uint64_t> unvisited = this->allVertices();
+    return DepthFirst::tree(this->size(), start, this->nextUnvisitedNeighbour(unvisited));
+}
+
+template<typename T, typename W, typename D>
+std::vector<uint64_t> Matrix::Graph<T, W, D>::allVertices() const {
+    std::vector<uint64_t> res(this->words(), ~uint64_t(0));
+    if (this->size() % 64 != 0) {
+        res.back() = (uint64_t(1) << (this->size() % 64)) - 1;
+    }
+    return res;
+}
+
+template<typename T, typename W, typename D>
+auto Matrix::Graph<T, W, D>::nextUnvisitedNeighbour(std::vector<uint64_t> &unvisited) const {
+    return [this, &unvisited](T v, size_t &next, T &z) {
+        if (next == 0) {
+            unvisited[size_t(v) / 64] &= ~(uint64_t(1) << (size_t(v) % 64));
+        }
+        if (!this->nextNeighbour(v, next, z, unvisited.data())) {
+            return false;
         }
+        unvisited[size_t(z) / 64] &= ~(uint64_t(1) << (size_t(z) % 64));
+        return true;
+    };
+}
+
+template<typename T, typename W, typename D>
+bool Matrix::Graph<T, W, D>::nextNeighbour(T v, size_t &next, T &z, const uint64_t *mask) const {
+    const uint64_t *row = this->row(size_t(v));
+    size_t word = next / 64;
+    if (word >= this->words()) {
+        return false;
     }
-    color[v] = Color::RED;
-    if (type == Type::Print::POSTORDER) {
-        res.push_back(v);
+
+    uint64_t bits = row[word] & (~uint64_t(0) << (next % 64));
+    if (mask != nullptr) {
+        bits &= mask[word];
     }
+    while (bits == 0) {
+        if (++word == this->words()) {
+            next = this->size();
+            return false;
+        }
+        bits = mask != nullptr ? row[word] & mask[word] : row[word];
+    }
+
+    size_t col = word * 64 + std::countr_zero(bits);
+    z = T(col);
+    next = col + 1;
+    return true;
 }
 
-template<typename T>
-bool Matrix::Graph<T>::isBipartite() {
+template<typename T, typename W, typename D>
+bool Matrix::Graph<T, W, D>::isBipartite() {
     Logger::debug("Check if the graph is bipartite...");
 
     std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
@@ -337,8 +748,38 @@ bool Matrix::Graph<T>::isBipartite() {
     return true;
 }
 
-template<typename T>
-bool Matrix::Graph<T>::isBipartiteVisit(T v, std::vector<Color> &color, std::vector<T> &parent,
+template<typename T, typename W, typename D>
+bool Matrix::Graph<T, W, D>::isBipartite(TraversalWorkspace<T, D> &workspace) {
+    workspace.reset(this->size());
+
+    for (size_t v = 0; v < this->size(); v++) {
+        if (!workspace.reached(T(v)) && !this->isBipartiteVisit(T(v), workspace)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T, typename W, typename D>
+bool Matrix::Graph<T, W, D>::isBipartiteVisit(T v, TraversalWorkspace<T, D> &workspace) {
+    size_t head = workspace.order().size();
+    workspace.reach(v, 0, -1);
+    while (head < workspace.order().size()) {
+        T w = workspace.order()[head++];
+        D level = workspace.distance(w);
+        for (auto [z, weight] : (*this)[w]) {
+            if (!workspace.reached(z)) {
+                workspace.reach(z, level + 1, w);
+            } else if (size_t(workspace.distance(z)) % 2 == size_t(level) % 2) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template<typename T, typename W, typename D>
+bool Matrix::Graph<T, W, D>::isBipartiteVisit(T v, std::vector<Color> &color, std::vector<T> &parent,
                                         std::vector<Color> &partie) {
     std::queue<int> q;
     color[v] = Color::WHITE;
@@ -347,23 +788,21 @@ bool Matrix::Graph<T>::isBipartiteVisit(T v, std::vector<Color> &color, std::vec
         int w = q.front();
         q.pop();
         Color nextColor = partie[w] == Color::BLUE ? Color::RED : Color::BLUE;
-        for (size_t z = 0; z < this->size(); z++) {
-            if (this->operator()(w, z).first == 1) {
-
-                // PART TO CHECK IF THE GRAPH IS BIPARTITE
-                if (partie[z] != Color::NONE) {
-                    if (partie[z] == partie[w]) {
-                        return false;
-                    }
-                } else {
-                    partie[z] = nextColor;
-                }
+        for (auto [z, weight] : (*this)[w]) {
 
-                if (color[z] == Color::BLUE) {
-                    color[z] = Color::WHITE;
-                    parent[z] = w;
-                    q.push(z);
+            // PART TO CHECK IF THE GRAPH IS BIPARTITE
+            if (partie[z] != Color::NONE) {
+                if (partie[z] == partie[w]) {
+                    return false;
                 }
+            } else {
+                partie[z] = nextColor;
+            }
+
+            if (color[z] == Color::BLUE) {
+                color[z] = Color::WHITE;
+                parent[z] = w;
+                q.push(z);
             }
         }
         color[w] = Color::RED;
@@ -371,70 +810,27 @@ bool Matrix::Graph<T>::isBipartiteVisit(T v, std::vector<Color> &color, std::vec
     return true;
 }
 
-template<typename T>
-std::optional<std::vector<T>> Matrix::Graph<T>::cycle() {
+template<typename T, typename W, typename D>
+std::optional<std::vector<T>> Matrix::Graph<T, W, D>::cycle() {
     Logger::debug("Check if the graph has a cycle...");
 
-    std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
-    std::vector<T> parent = std::vector<T>(this->size(), -1);
-    std::vector<T> cycle;
+    DepthFirst::CycleVisitor<T> visitor(this->size(), this->_d == Type::DIRECTED);
+    DepthFirst::forest(this->size(), T(0), [this](T v, size_t &next, T &z) {
+        return this->nextNeighbour(v, next, z);
+    }, visitor);
 
-    for (size_t v = 0; v < this->size(); v++) {
-        if (color[v] == Color::BLUE) {
-            if (this->cycleVisit(v, color, parent, cycle, -1)) {
-                return cycle;
-            }
-        }
+    if (visitor.stopped) {
+        return visitor.cycle;
     }
     return std::nullopt;
 }
 
-template<typename T>
-bool Matrix::Graph<T>::cycleVisit(T v, std::vector<Color> &color, std::vector<T> &parent, std::vector<T> &cycle,
-                                  T prev) {
-    color[v] = Color::WHITE;
-    if (vectorUtils<T>::isInVector(cycle, v)) {
-        cycle.push_back(v);
-        return true;
-    }
-
-    cycle.push_back(v);
-
-    for (size_t w = 0; w < this->size(); w++) {
-        if (this->operator()(v, w).first == 1) {
-            if (color[w] == Color::BLUE) {
-                parent[w] = v;
-                if (this->cycleVisit(w, color, parent, cycle, v)) {
-                    return true;
-                }
-            } else if (w != prev) {
-                cycle.push_back(w);
-                return true;
-            }
-
-        }
-    }
-
-    color[v] = Color::RED;
-
-    vectorUtils<T>::removeElementsFromVector(cycle, v);
-
-    return false;
-}
-
-template<typename T>
-bool Matrix::Graph<T>::eulerianCycle() {
+template<typename T, typename W, typename D>
+bool Matrix::Graph<T, W, D>::eulerianCycle() {
     Logger::debug("Check if the graph is eulerian...");
 
     for (size_t j = 0; j < this->size(); j++) {
-        T res = 0;
-        for (size_t i = 0; i < this->size(); i++) {
-            if (this->operator()(j, i).first == 1) {
-                res++;
-            }
-        }
-
-        if (static_cast<int>(res) % 2 != 0) {
+        if (this->count(j) % 2 != 0) {
             return false;
         }
     }
@@ -442,147 +838,138 @@ bool Matrix::Graph<T>::eulerianCycle() {
     return true;
 }
 
-template<typename T>
-std::vector<T> Matrix::Graph<T>::distanceFrom(T v) {
+template<typename T, typename W, typename D>
+std::vector<D> Matrix::Graph<T, W, D>::distanceFrom(T v) {
     Logger::debug("Distance from " + std::to_string(v) + " algorithm starting...");
-    std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
     std::vector<T> parent = std::vector<T>(this->size(), -1);
-    std::vector<T> distance = std::vector<T>(this->size());
+    std::vector<D> distance = std::vector<D>(this->size(), -1);
 
-    this->distanceFromSourceVisit(v, color, parent, distance);
+    this->distanceFromSourceVisit(v, parent, distance);
 
     return distance;
 }
 
-template<typename T>
-void Matrix::Graph<T>::distanceFromSourceVisit(T v, std::vector<Color> &color, std::vector<T> &parent,
-                                               std::vector<T> &distance) {
-    std::queue<T> q;
-    color[v] = Color::WHITE;
-    q.push(v);
-    while (!q.empty()) {
-        T w = q.front();
-        q.pop();
-        for (size_t z = 0; z < this->size(); z++) {
-            if (this->operator()(w, z).first == 1) {
-                if (color[z] == Color::BLUE) {
-                    color[z] = Color::WHITE;
-                    parent[z] = w;
-                    distance[z] = distance[w] + this->at(w, z).second;
-                    q.push(z);
-                }
-            }
+template<typename T, typename W, typename D>
+void Matrix::Graph<T, W, D>::distanceFrom(T v, TraversalWorkspace<T, D> &workspace) {
+    this->distanceFromSourceVisit(v, workspace);
+}
+
+template<typename T, typename W, typename D>
+void Matrix::Graph<T, W, D>::distanceFromSourceVisit(T v, std::vector<T> &parent, std::vector<D> &distance) {
+    ShortestPath::dijkstra(v, distance, parent, D(this->_minWeight), D(this->_maxWeight), [this](T w, auto &&relax) {
+        for (auto [z, weight] : (*this)[w]) {
+            relax(z, D(weight));
         }
-        color[w] = Color::RED;
-    }
+    });
 }
 
-template<typename T>
-std::vector<T> Matrix::Graph<T>::distanceFromSource() {
+template<typename T, typename W, typename D>
+void Matrix::Graph<T, W, D>::distanceFromSourceVisit(T v, TraversalWorkspace<T, D> &workspace) {
+    workspace.reset(this->size());
+    workspace.queues().with(D(this->_minWeight), D(this->_maxWeight), [&](auto &queue) {
+        ShortestPath::settle(v, workspace, queue, [this](T w, auto &&relax) {
+            for (auto [z, weight] : (*this)[w]) {
+                relax(z, D(weight));
+            }
+        });
+    });
+}
+
+template<typename T, typename W, typename D>
+std::vector<D> Matrix::Graph<T, W, D>::distanceFromSource() {
     return this->distanceFrom(0);
 }
 
-template<typename T>
-std::pair<T, std::pair<T, T>> Matrix::Graph<T>::longestPath() {
+template<typename T, typename W, typename D>
+std::pair<T, std::pair<T, T>> Matrix::Graph<T, W, D>::longestPath() {
     Logger::debug("Longest path algorithm starting...");
     if (this->_d != Type::DIRECTED) {
         std::cout << "" << std::endl;
         throw std::invalid_argument("The graph must be directed");
     }
 
-    std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
-    std::vector<T> parent = std::vector<T>(this->size(), -1);
-    std::pair<T, std::pair<T, T>> lPath = {0, {0, 0}};
-    std::pair<T, std::pair<T, T>> actualPath = {0, {0, 0}};
+    DepthFirst::OrderVisitor<T> visitor(Type::Print::POSTORDER);
+    DepthFirst::forest(this->size(), T(0), [this](T v, size_t &next, T &z) {
+        return this->nextNeighbour(v, next, z);
+    }, visitor);
+
+    if (visitor.backEdge) {
+        throw std::invalid_argument("The graph must not have a cycle");
+    }
+
+    // longest[v] = std::pair(edges, last vertex) of the longest path from v, its successors come first in postorder
+    std::vector<std::pair<T, T>> longest(this->size());
+    for (T v : visitor.res) {
+        longest[size_t(v)] = {0, v};
+        for (auto [w, weight] : (*this)[v]) {
+            if (longest[size_t(w)].first + 1 > longest[size_t(v)].first) {
+                longest[size_t(v)] = {longest[size_t(w)].first + 1, longest[size_t(w)].second};
+            }
+        }
+    }
 
+    std::pair<T, std::pair<T, T>> lPath = {0, {0, 0}};
     for (size_t v = 0; v < this->size(); v++) {
-        if (color[v] == Color::BLUE) {
-            actualPath = {0, {v, v}};
-            this->longestPathVisit(v, color, parent, lPath, actualPath, -1);
+        if (longest[v].first > lPath.first) {
+            lPath = {longest[v].first, {T(v), longest[v].second}};
         }
     }
 
     return lPath;
 }
 
-template<typename T>
-void Matrix::Graph<T>::longestPathVisit(T v, std::vector<Color> &color, std::vector<T> &parent,
-                                        std::pair<T, std::pair<T, T>> &lPath,
-                                        std::pair<T, std::pair<T, T>> actualPath, T previous) {
-    color[v] = Color::WHITE;
-    actualPath.first += 1;
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, std::vector<T>>> Matrix::Graph<T, W, D>::path(T from, T to) {
+    Logger::debug("Path algorithm starting...");
+    if (from < 0 || from > this->size() || to < 0 || to > this->size()) {
+        throw std::invalid_argument("int param have to be between 0 and the _size of the graph");
+    }
 
-    for (size_t w = 0; w < this->size(); w++) {
-        if (this->operator()(v, w).first == 1) {
-            if (w != previous) {
-                actualPath.second.second = w;
+    DepthFirst::Colors<T> color(this->size());
+    std::vector<std::pair<T, size_t>> stack;
+    std::vector<uint64_t> unvisited = this->allVertices();
+    auto nextNeighbour = this->nextUnvisitedNeighbour(unvisited);
 
-                if (actualPath.first > lPath.first) {
-                    lPath = actualPath;
-                }
-            }
+    DepthFirst::PathVisitor<T> visitor(to);
+    DepthFirst::visit(from, color, stack, nextNeighbour, visitor);
 
-            if (w != previous) {
-                parent[w] = v;
-                this->longestPathVisit(w, color, parent, lPath, actualPath, v);
-            }
-        }
+    if (!visitor.stopped) {
+        return std::nullopt;
     }
-    color[v] = Color::RED;
+    return std::make_pair(D(visitor.path.size() - 1), visitor.path);
 }
 
-template<typename T>
-std::optional<std::pair<T, std::vector<T>>> Matrix::Graph<T>::path(T from, T to) {
-    Logger::debug("Path algorithm starting...");
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, std::span<const T>>> Matrix::Graph<T, W, D>::path(T from, T to, TraversalWorkspace<T, D> &workspace) {
     if (from < 0 || from > this->size() || to < 0 || to > this->size()) {
         throw std::invalid_argument("int param have to be between 0 and the _size of the graph");
     }
 
-    std::vector<Color> color = std::vector<Color>(this->size(), Color::BLUE);
-    std::vector<T> parent = std::vector<T>(this->size(), -1);
-    std::pair<T, std::vector<T>> path = {0, {from}};
-    std::pair<T, T> param = {from, to};
-
-    return this->pathVisit(from, color, parent, path, param);
-}
+    workspace.reset(this->size());
+    auto nextNeighbour = [this](T v, size_t &next, T &z) {
+        return this->nextNeighbour(v, next, z);
+    };
 
-template<typename T>
-std::optional<std::pair<T, std::vector<T>>>
-Matrix::Graph<T>::pathVisit(T v, std::vector<Color> &color, std::vector<T> &parent,
-                            std::pair<T, std::vector<T>> path, std::pair<T, T> &param) {
-    color[v] = Color::WHITE;
-    path.first += 1;
-    for (size_t w = 0; w < this->size(); w++) {
-        if (this->operator()(v, w).first == 1) {
-            if (color[w] == Color::BLUE) {
-                parent[w] = v;
-                path.second.push_back(w);
-
-                if (w == param.second) {
-                    return path;
-                }
+    // the visitor borrows the memory of the buffer and gives it back
+    DepthFirst::PathVisitor<T> visitor(to);
+    visitor.path = std::move(workspace.buffer());
+    visitor.path.clear();
+    DepthFirst::visit(from, workspace, workspace.stack(), nextNeighbour, visitor);
+    workspace.buffer() = std::move(visitor.path);
 
-                auto newPath = this->pathVisit(w, color, parent, path, param);
-                if (newPath.has_value()) {
-                    return newPath;
-                } else {
-                    path.second.pop_back();
-                }
-            }
-        }
+    if (!visitor.stopped) {
+        return std::nullopt;
     }
-
-    color[v] = Color::RED;
-    return std::nullopt;
+    return std::make_pair(D(workspace.buffer().size() - 1), std::span<const T>(workspace.buffer()));
 }
 
-template<typename T>
-std::optional<T> Matrix::Graph<T>::blackHole() {
+template<typename T, typename W, typename D>
+std::optional<T> Matrix::Graph<T, W, D>::blackHole() {
     Logger::debug("Black hole algorithm starting...");
     int candidate = 0;
     for (size_t i = 1; i < this->size(); i++) {
-        if (this->_m[candidate * this->size() + i].first == 1) {
-            Logger::debug("New candidate : " + std::to_string(i) + " with " + std::to_string(this->_m[candidate * this->size() + i].first) + " edge(s)");
+        if (this->test(candidate, i)) {
+            Logger::debug("New candidate : " + std::to_string(i));
             candidate = i;
         }
     }
@@ -590,7 +977,7 @@ std::optional<T> Matrix::Graph<T>::blackHole() {
     bool Ok = true;
 
     for (size_t i = 1; i < this->size(); i++) {
-        if (this->_m[candidate * this->size() + i].first == 1 || this->_m[i * this->size() + candidate].first == 0) {
+        if (this->test(candidate, i) || !this->test(i, candidate)) {
             Logger::debug("Candidate " + std::to_string(candidate) + " is not a black hole");
             Ok = false;
         }
@@ -599,9 +986,9 @@ std::optional<T> Matrix::Graph<T>::blackHole() {
     return Ok ? std::optional<T>(candidate) : std::nullopt;
 }
 
-template<typename T>
-std::optional<std::pair<T, T>> Matrix::Graph<T>::eccentricity(T v) {
-    std::optional<std::pair<T, T>> res;
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, T>> Matrix::Graph<T, W, D>::eccentricity(T v) {
+    std::optional<std::pair<D, T>> res;
 
     auto dist = this->distanceFrom(v);
 
@@ -614,60 +1001,208 @@ std::optional<std::pair<T, T>> Matrix::Graph<T>::eccentricity(T v) {
     return res;
 }
 
-template<typename T>
-std::optional<std::pair<T, std::pair<T, T>>> Matrix::Graph<T>::radius() {
-    std::optional<std::pair<T, std::pair<T, T>>> minEccentricity;
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, T>> Matrix::Graph<T, W, D>::eccentricity(T v, TraversalWorkspace<T, D> &workspace) {
+    this->distanceFromSourceVisit(v, workspace);
+    return Eccentricity::farthest(v, workspace);
+}
+
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, std::pair<T, T>>> Matrix::Graph<T, W, D>::radius() {
+    Logger::debug("Radius algorithm starting...");
+    return Eccentricity::boundingDiameters<T, D>(this->size(), this->_d == Type::UNDIRECTED, false, [this](T v, TraversalWorkspace<T, D> &workspace) {
+        this->distanceFromSourceVisit(v, workspace);
+    });
+}
+
+template<typename T, typename W, typename D>
+std::optional<std::pair<D, std::pair<T, T>>> Matrix::Graph<T, W, D>::diameter() {
+    Logger::debug("Diameter algorithm starting...");
+    return Eccentricity::boundingDiameters<T, D>(this->size(), this->_d == Type::UNDIRECTED, true, [this](T v, TraversalWorkspace<T, D> &workspace) {
+        this->distanceFromSourceVisit(v, workspace);
+    });
+}
+
+template<typename T, typename W, typename D>
+template<typename C>
+Matrix::M<C> Matrix::Graph<T, W, D>::toMatrix() const {
+    M<C> res(this->size(), this->size());
 
     for (size_t i = 0; i < this->size(); i++) {
-        auto ecc = this->eccentricity(i);
-        if (ecc.has_value() && (!minEccentricity.has_value() || minEccentricity.value().first > ecc.value().first)) {
-            minEccentricity = {ecc.value().first, {i, ecc.value().second}};
+        for (auto [j, weight] : (*this)[i]) {
+            res(i, size_t(j), 1);
         }
     }
 
-    return minEccentricity;
+    return res;
 }
 
-template<typename T>
-std::optional<std::pair<T, std::pair<T, T>>> Matrix::Graph<T>::diameter() {
-    std::optional<std::pair<T, std::pair<T, T>>> minEccentricity;
+template<typename T, typename W, typename D>
+template<typename C, typename S>
+Matrix::M<C> Matrix::Graph<T, W, D>::matrixPath(size_t lenght, size_t threads) {
+    if (lenght > size_t(std::numeric_limits<int>::max())) {
+        throw std::invalid_argument("The lenght of the walks is too large");
+    }
+    return M<C>::template power<S>(this->template toMatrix<C>(), int(lenght), threads);
+}
+
+template<typename T, typename W, typename D>
+Matrix::BoolMatrix Matrix::Graph<T, W, D>::toBoolMatrix() const {
+    return BoolMatrix(this->size(), this->row(0));
+}
+
+template<typename T, typename W, typename D>
+Matrix::BoolMatrix Matrix::Graph<T, W, D>::reachability(T lenght) const {
+    return BoolMatrix::power(this->toBoolMatrix(), int(lenght));
+}
+
+template<typename T, typename W, typename D>
+Matrix::BoolMatrix Matrix::Graph<T, W, D>::transitiveClosure() const {
+    Logger::debug("Transitive closure algorithm starting...");
+
+    BoolMatrix res = this->toBoolMatrix();
+    while (true) {
+        BoolMatrix next = res | res * res;
+        if (next == res) {
+            return res;
+        }
+        res = std::move(next);
+    }
+}
+
+template<typename T, typename W, typename D>
+Matrix::M<D> Matrix::Graph<T, W, D>::allPairsDistances(size_t threads) const {
+    Logger::debug("All pairs distances algorithm starting...");
 
+    using MinPlus = Semiring::MinPlus<D>;
+    M<D> distance = M<D>::template identityMatrix<MinPlus>(this->size());
     for (size_t i = 0; i < this->size(); i++) {
-        auto ecc = this->eccentricity(i);
-        if (ecc.has_value() && (!minEccentricity.has_value() || minEccentricity.value().first < ecc.value().first)) {
-            minEccentricity = {ecc.value().first, {i, ecc.value().second}};
+        for (auto [j, weight] : (*this)[i]) {
+            distance(i, size_t(j), std::min(distance(i, size_t(j)), D(weight)));
         }
     }
 
-    return minEccentricity;
+    // after k squarings the walks of up to 2^k edges are covered, n - 1 edges are enough
+    ThreadPool pool(threads);
+    for (size_t edges = 1; edges < this->size(); edges *= 2) {
+        M<D> next = distance.template multiply<MinPlus>(distance, pool);
+        if (next == distance) {
+            break;
+        }
+        distance = next;
+    }
+
+    for (size_t i = 0; i < this->size(); i++) {
+        for (size_t j = 0; j < this->size(); j++) {
+            if (distance(i, j) == MinPlus::zero()) {
+                distance(i, j, -1);
+            }
+        }
+    }
+
+    return distance;
 }
 
-template<typename T>
-Matrix::M<T> Matrix::Graph<T>::matrixPath(T lenght) {
-    M<T> res(size(), size());
+template<typename T, typename W, typename D>
+std::pair<Matrix::M<D>, std::optional<Matrix::M<D>>> Matrix::Graph<T, W, D>::floydWarshall(bool nextHop, size_t threads) const {
+    Logger::debug("Floyd-Warshall algorithm starting...");
+
+    using MinPlus = Semiring::MinPlus<D>;
+    const size_t n = this->size();
+    M<D> distance = M<D>::template identityMatrix<MinPlus>(n);
+    std::optional<M<D>> next;
+    if (nextHop) {
+        next.emplace(n, n);
+        next.value().fill(-1);
+    }
 
-    res = (*this);
+    for (size_t i = 0; i < n; i++) {
+        if (nextHop) {
+            next.value()(i, i, D(i));
+        }
+        for (auto [j, weight] : (*this)[i]) {
+            if (D(weight) < distance(i, size_t(j))) {
+                distance(i, size_t(j), D(weight));
+                if (nextHop) {
+                    next.value()(i, size_t(j), D(j));
+                }
+            }
+        }
+    }
+
+    ThreadPool pool(threads);
+    FloydWarshall::blocked(distance.data(), nextHop ? next.value().data() : nullptr, n, pool);
+
+    for (size_t i = 0; i < n; i++) {
+        if (distance(i, i) < 0) {
+            throw std::invalid_argument("The graph must not have a negative cycle");
+        }
+        for (size_t j = 0; j < n; j++) {
+            if (distance(i, j) == MinPlus::zero()) {
+                distance(i, j, -1);
+            }
+        }
+    }
 
-    return res^lenght;
+    return {distance, next};
 }
 
-template<typename T>
-Matrix::M<T> Matrix::Graph<T>::matrixAllPath() {
-    M temp(*this);
+template<typename T, typename W, typename D>
+std::vector<T> Matrix::Graph<T, W, D>::nextHopPath(const M<D> &next, T from, T to) {
+    std::vector<T> res;
+    if (next(size_t(from), size_t(to)) == -1) {
+        return res;
+    }
 
-    for (size_t i = 1; i < this->size(); i++) {
-        temp += this->operator^(i);
+    res.push_back(from);
+    while (from != to) {
+        from = T(next(size_t(from), size_t(to)));
+        res.push_back(from);
+    }
+    return res;
+}
+
+template<typename T, typename W, typename D>
+template<typename C, typename S>
+Matrix::M<C> Matrix::Graph<T, W, D>::matrixAllPath(bool untilStable, size_t threads) {
+    Logger::debug("All paths matrix algorithm starting...");
+
+    ThreadPool pool(threads);
+    M<C> adjacency = this->template toMatrix<C>();
+    M<C> power(adjacency);
+    M<C> next(this->size(), this->size());
+    M<C> res(adjacency);
+
+    for (size_t lenght = 2; lenght < this->size(); lenght++) {
+        M<C>::template product<S>(power, adjacency, next, pool);
+        power.swap(next);
+
+        bool reachedNew = false;
+        for (size_t i = 0; i < this->size(); i++) {
+            for (size_t j = 0; j < this->size(); j++) {
+                C count = power(i, j);
+                if (count != S::zero()) {
+                    reachedNew |= res(i, j) == S::zero();
+                    res(i, j) = S::add(res(i, j), count);
+                }
+            }
+        }
+
+        if (untilStable && !reachedNew) {
+            Logger::debug("All paths matrix stable after " + std::to_string(lenght) + " edges");
+            break;
+        }
     }
 
-    return temp;
+    return res;
 }
 
-template<typename T>
-Matrix::Graph<T> Matrix::Graph<T>::createRandomGraph(int numberOfVertices, Type::Graph directed, double edgeProbability,
+template<typename T, typename W, typename D>
+Matrix::Graph<T, W, D> Matrix::Graph<T, W, D>::createRandomGraph(size_t numberOfVertices, Type::Graph directed, double edgeProbability,
                                                      bool includeRandomWeight) {
     Logger::debug("Creating random graph with " + std::to_string(numberOfVertices) + " vertices.");
 
-    if (numberOfVertices <= 0 || edgeProbability < 0.0 || edgeProbability > 1.0) {
+    if (numberOfVertices == 0 || edgeProbability < 0.0 || edgeProbability > 1.0) {
         throw std::invalid_argument("Invalid input parameters.");
     }
 
@@ -676,9 +1211,9 @@ Matrix::Graph<T> Matrix::Graph<T>::createRandomGraph(int numberOfVertices, Type:
     std::uniform_real_distribution<double> edgeDist(0.0, 1.0);
     std::uniform_int_distribution<int> weightDist(1, 100); // Random weight between 1 and 100
 
-    Matrix::Graph<T> g = Matrix::Graph<T>(numberOfVertices, directed);
-    for (int i = 0; i < numberOfVertices; i++) {
-        for (int j = i + 1; j < numberOfVertices; j++) {
+    Graph g = Graph(numberOfVertices, directed);
+    for (T i = 0; i < numberOfVertices; i++) {
+        for (T j = i + 1; j < numberOfVertices; j++) {
             if (edgeDist(gen) < edgeProbability) {
                 int w = 1;
                 if (includeRandomWeight) {
@@ -692,39 +1227,39 @@ Matrix::Graph<T> Matrix::Graph<T>::createRandomGraph(int numberOfVertices, Type:
     return g;
 }
 
-template<typename T>
-Matrix::Graph<T> Matrix::Graph<T>::createCycleGraph(int numberOfVertices, Type::Graph directed, bool includeRandomWeight) {
+template<typename T, typename W, typename D>
+Matrix::Graph<T, W, D> Matrix::Graph<T, W, D>::createCycleGraph(size_t numberOfVertices, Type::Graph directed, bool includeRandomWeight) {
     Logger::debug("Creating cycle graph with " + std::to_string(numberOfVertices) + " vertices.");
 
-    if (numberOfVertices <= 0) {
+    if (numberOfVertices == 0) {
         throw std::invalid_argument("Invalid input parameters.");
     }
 
     std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<T> weightDist(1, 100); // Random weight between 1 and 100
+    std::uniform_int_distribution<int> weightDist(1, 100); // Random weight between 1 and 100
 
 
-    Matrix::Graph<T> g = Matrix::Graph<T>(numberOfVertices, directed);
-    for (int i = 0; i < numberOfVertices; i++) {
+    Graph g = Graph(numberOfVertices, directed);
+    for (T i = 0; i < numberOfVertices; i++) {
         g.addEdge(i, (i + 1) % numberOfVertices, includeRandomWeight ? weightDist(gen) : 1);
     }
     return g;
 }
 
-template<typename T>
-Matrix::Graph<T> Matrix::Graph<T>::createBlackHoleGraph(int numberOfVertices, Type::Graph directed, bool includeRandomWeight, T blackHole) {
+template<typename T, typename W, typename D>
+Matrix::Graph<T, W, D> Matrix::Graph<T, W, D>::createBlackHoleGraph(size_t numberOfVertices, Type::Graph directed, bool includeRandomWeight, T blackHole) {
     Logger::debug("Creating black hole graph with " + std::to_string(numberOfVertices) + " vertices.\nStarting black hole at " + std::to_string(blackHole));
 
-    if (numberOfVertices <= 0) {
+    if (numberOfVertices == 0) {
         throw std::invalid_argument("Invalid input parameters.");
     }
 
     std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<T> weightDist(1, 100); // Random weight between 1 and 100
+    std::uniform_int_distribution<int> weightDist(1, 100); // Random weight between 1 and 100
 
-    Matrix::Graph<T> g = Matrix::Graph<T>(numberOfVertices, directed);
+    Graph g = Graph(numberOfVertices, directed);
     for (T i = 0; i < numberOfVertices; i++) {
         if (i != blackHole) {
             g.addEdge(i, blackHole, includeRandomWeight ? weightDist(gen) : 1);
@@ -733,19 +1268,19 @@ Matrix::Graph<T> Matrix::Graph<T>::createBlackHoleGraph(int numberOfVertices, Ty
     return g;
 }
 
-template<typename T>
-Matrix::Graph<T> Matrix::Graph<T>::createCompleteGraph(int numberOfVertices, Type::Graph directed, bool includeRandomWeight) {
+template<typename T, typename W, typename D>
+Matrix::Graph<T, W, D> Matrix::Graph<T, W, D>::createCompleteGraph(size_t numberOfVertices, Type::Graph directed, bool includeRandomWeight) {
     Logger::debug("Creating complete graph with " + std::to_string(numberOfVertices) + " vertices.");
 
-    if (numberOfVertices <= 0) {
+    if (numberOfVertices == 0) {
         throw std::invalid_argument("Invalid input parameters.");
     }
 
     std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<T> weightDist(1, 100); // Random weight between 1 and 100
+    std::uniform_int_distribution<int> weightDist(1, 100); // Random weight between 1 and 100
 
-    Matrix::Graph<T> g = Matrix::Graph<T>(numberOfVertices, directed);
+    Graph g = Graph(numberOfVertices, directed);
     for (T i = 0; i < numberOfVertices; i++) {
         for (T j = i + 1; j < numberOfVertices; j++) {
             g.addEdge(i, j, includeRandomWeight ? weightDist(gen) : 1);
@@ -754,19 +1289,19 @@ Matrix::Graph<T> Matrix::Graph<T>::createCompleteGraph(int numberOfVertices, Typ
     return g;
 }
 
-template<typename T>
-Matrix::Graph<T> Matrix::Graph<T>::createBipartiteGraph(int numberOfVertices, Type::Graph directed, bool includeRandomWeight) {
+template<typename T, typename W, typename D>
+Matrix::Graph<T, W, D> Matrix::Graph<T, W, D>::createBipartiteGraph(size_t numberOfVertices, Type::Graph directed, bool includeRandomWeight) {
     Logger::debug("Creating bipartite graph with " + std::to_string(numberOfVertices) + " vertices");
 
-    if (numberOfVertices <= 0) {
+    if (numberOfVertices == 0) {
         throw std::invalid_argument("Invalid input parameters.");
     }
 
     std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<T> weightDist(1, 100); // Random weight between 1 and 100
+    std::uniform_int_distribution<int> weightDist(1, 100); // Random weight between 1 and 100
 
-    Matrix::Graph<T> g = Matrix::Graph<T>(numberOfVertices, directed);
+    Graph g = Graph(numberOfVertices, directed);
     for (T i = 0; i < numberOfVertices / 2; i++) {
         for (T j = numberOfVertices / 2; j < numberOfVertices; j++) {
             g.addEdge(i, j, includeRandomWeight ? weightDist(gen) : 1);
@@ -775,44 +1310,36 @@ Matrix::Graph<T> Matrix::Graph<T>::createBipartiteGraph(int numberOfVertices, Ty
     return g;
 }
 
-template<typename T>
-Matrix::Graph<T> Matrix::Graph<T>::createStarGraph(int numberOfVertices, Type::Graph directed, bool includeRandomWeight) {
+template<typename T, typename W, typename D>
+Matrix::Graph<T, W, D> Matrix::Graph<T, W, D>::createStarGraph(size_t numberOfVertices, Type::Graph directed, bool includeRandomWeight) {
     Logger::debug("Creating star graph with " + std::to_string(numberOfVertices) + " vertices");
 
-    if (numberOfVertices <= 0) {
+    if (numberOfVertices == 0) {
         throw std::invalid_argument("Invalid input parameters.");
     }
 
     std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<T> weightDist(1, 100); // Random weight between 1 and 100
+    std::uniform_int_distribution<int> weightDist(1, 100); // Random weight between 1 and 100
 
-    Matrix::Graph<T> g = Matrix::Graph<T>(numberOfVertices, directed);
+    Graph g = Graph(numberOfVertices, directed);
     for (T i = 1; i < numberOfVertices; i++) {
         g.addEdge(0, i, includeRandomWeight ? weightDist(gen) : 1);
     }
     return g;
 }
 
-template<typename T>
-Type::Graph Matrix::Graph<T>::directed() const {
+template<typename T, typename W, typename D>
+Type::Graph Matrix::Graph<T, W, D>::directed() const {
     return this->_d;
 }
 
-template<typename T>
-size_t Matrix::Graph<T>::size() const {
+template<typename T, typename W, typename D>
+size_t Matrix::Graph<T, W, D>::size() const {
     return this->_size;
 }
 
-template<typename T>
-std::vector<std::pair<T, T>> Matrix::Graph<T>::operator[](T vertex) const {
-    std::vector<std::pair<T, T>> res;
-
-    for (size_t i = 0; i < this->size(); i++) {
-        if (this->at(vertex, i).first == 1) {
-            res.push_back(std::make_pair(i ,this->at(vertex, i).second));
-        }
-    }
-
-    return res;
+template<typename T, typename W, typename D>
+Matrix::Neighbours<T, typename Matrix::Graph<T, W, D>::Weight> Matrix::Graph<T, W, D>::operator[](T vertex) const {
+    return Neighbours<T, Weight>(this, size_t(vertex));
 }
\ No newline at end of file
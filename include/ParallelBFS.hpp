@@ -0,0 +1,59 @@
+#pragma once
+
+#include "ThreadPool.hpp"
+
+#include <atomic>
+#include <vector>
+
+namespace Parallel {
+    /**
+     * @brief Level-synchronous BFS from v, every level is split between the threads of the pool
+     * a vertex is claimed with an atomic exchange on visited, the thread that wins it sets its parent and distance
+     * and keeps it in its own next frontier, the local frontiers are then copied side by side without any lock
+     * @param v -> the starting vertex
+     * @param visited -> claimed vertices, shared between calls so other components can be visited afterwards
+     * @param parent -> parent in the BFS tree
+     * @param distance -> number of edges from v, D may be wider than the vertices
+     * @param res -> visited vertices, level after level
+     * @param pool -> the threads
+     * @param forEachNeighbour -> forEachNeighbour(w, f) calls f(z) for every edge w -> z
+     */
+    template<typename T, typename D, typename ForEachNeighbour>
+    void levelSynchronousBFS(T v, std::vector<std::atomic<bool>> &visited, std::vector<T> &parent, std::vector<D> &distance, std::vector<T> &res, ThreadPool &pool, ForEachNeighbour forEachNeighbour) {
+        std::vector<std::vector<T>> local(pool.size());
+        std::vector<size_t> offsets(pool.size() + 1);
+        std::vector<T> frontier = {v};
+        std::vector<T> next;
+
+        visited[v].store(true, std::memory_order_relaxed);
+        distance[v] = 0;
+
+        for (D level = 1; !frontier.empty(); level++) {
+            pool.parallelFor(frontier.size(), [&](size_t id, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++) {
+                    T w = frontier[i];
+                    forEachNeighbour(w, [&](T z) {
+                        if (!visited[z].load(std::memory_order_relaxed) && !visited[z].exchange(true, std::memory_order_acq_rel)) {
+                            parent[z] = w;
+                            distance[z] = level;
+                            local[id].push_back(z);
+                        }
+                    });
+                }
+            });
+
+            res.insert(res.end(), frontier.begin(), frontier.end());
+
+            for (size_t id = 0; id < local.size(); id++) {
+                offsets[id + 1] = offsets[id] + local[id].size();
+            }
+            next.resize(offsets.back());
+            pool.run([&](size_t id) {
+                std::copy(local[id].begin(), local[id].end(), next.begin() + offsets[id]);
+                local[id].clear();
+            });
+
+            std::swap(frontier, next);
+        }
+    }
+}
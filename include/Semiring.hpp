@@ -0,0 +1,78 @@
+#pragma once
+
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+
+/**
+ * @brief Policies giving the (add, mul) pair used by the matrix products
+ * zero is the identity of add and absorbs mul, one is the identity of mul,
+ * so the padding of the blocked kernel is zero and the diagonal of an identity matrix is one
+ */
+namespace Semiring {
+    /**
+     * @brief Usual (+, *), counts the walks
+     */
+    template<typename T>
+    struct Plus {
+        static constexpr T zero() { return T(0); }
+        static constexpr T one() { return T(1); }
+        static constexpr T add(T a, T b) { return a + b; }
+        static constexpr T mul(T a, T b) { return a * b; }
+    };
+
+    /**
+     * @brief Value standing for "no walk" in the tropical semirings, infinity when T has one
+     */
+    template<typename T>
+    constexpr T infinity() {
+        return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+    }
+
+    /**
+     * @brief (min, +), the product gives the shortest walks
+     */
+    template<typename T>
+    struct MinPlus {
+        static constexpr T zero() { return infinity<T>(); }
+        static constexpr T one() { return T(0); }
+        static constexpr T add(T a, T b) { return std::min(a, b); }
+        static constexpr T mul(T a, T b) { return a == zero() || b == zero() ? zero() : T(a + b); }
+    };
+
+    /**
+     * @brief (max, +), the product gives the longest walks, e.g. the critical paths of a DAG
+     */
+    template<typename T>
+    struct MaxPlus {
+        static constexpr T zero() { return -infinity<T>(); }
+        static constexpr T one() { return T(0); }
+        static constexpr T add(T a, T b) { return std::max(a, b); }
+        static constexpr T mul(T a, T b) { return a == zero() || b == zero() ? zero() : T(a + b); }
+    };
+
+    /**
+     * @brief (or, and) on 0 and 1, any non zero value is true
+     */
+    template<typename T>
+    struct Boolean {
+        static constexpr T zero() { return T(0); }
+        static constexpr T one() { return T(1); }
+        static constexpr T add(T a, T b) { return a != T(0) || b != T(0) ? T(1) : T(0); }
+        static constexpr T mul(T a, T b) { return a != T(0) && b != T(0) ? T(1) : T(0); }
+    };
+
+    /**
+     * @brief (+, *) modulo Mod for integer types, counts the walks without overflowing
+     * the operands must be in [0, Mod)
+     */
+    template<typename T, uint64_t Mod = 1000000007>
+    struct ModCount {
+        static_assert(std::numeric_limits<T>::is_integer, "ModCount needs an integer type");
+
+        static constexpr T zero() { return T(0); }
+        static constexpr T one() { return T(1 % Mod); }
+        static constexpr T add(T a, T b) { return T((uint64_t(a) + uint64_t(b)) % Mod); }
+        static constexpr T mul(T a, T b) { return T(uint64_t(a) * uint64_t(b) % Mod); }
+    };
+}
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ShortestPath {
+    /**
+     * @brief Largest edge weight still served by a bucket queue, heavier graphs fall back to a heap
+     */
+    constexpr size_t maxBucketWeight = size_t(1) << 16;
+
+    /**
+     * @brief Dial bucket queue for integer keys
+     * while the smallest key is d every key lies in [d, d + maxWeight], so maxWeight + 1 buckets used in a circle are enough
+     * @tparam T the vertices, K the keys
+     */
+    template<typename T, typename K = T>
+    class BucketQueue {
+    private:
+        std::vector<std::vector<std::pair<T, K>>> buckets;
+        size_t current = 0;
+        size_t count = 0;
+
+    public:
+        using key_type = K;
+
+        /**
+         * @param maxWeight -> the heaviest edge of the graph
+         */
+        explicit BucketQueue(K maxWeight) : buckets(size_t(maxWeight) + 1) {}
+
+        [[nodiscard]] bool empty() const {
+            return this->count == 0;
+        }
+
+        [[nodiscard]] K maxWeight() const {
+            return K(this->buckets.size() - 1);
+        }
+
+        /**
+         * @brief Drop the remaining entries and start again from key 0, the buckets keep their memory
+         */
+        void clear() {
+            for (size_t i = this->current; this->count > 0; i = (i + 1) % this->buckets.size()) {
+                this->count -= this->buckets[i].size();
+                this->buckets[i].clear();
+            }
+            this->current = 0;
+        }
+
+        void push(T vertex, K key) {
+            this->buckets[size_t(key) % this->buckets.size()].emplace_back(vertex, key);
+            this->count++;
+        }
+
+        /**
+         * @brief Remove an entry with the smallest key
+         * @return std::pair(vertex, key)
+         */
+        std::pair<T, K> pop() {
+            while (this->buckets[this->current].empty()) {
+                this->current = (this->current + 1) % this->buckets.size();
+            }
+            std::pair<T, K> top = this->buckets[this->current].back();
+            this->buckets[this->current].pop_back();
+            this->count--;
+            return top;
+        }
+    };
+
+    /**
+     * @brief Implicit d-ary min heap, shallower than a binary heap so pushes are cheaper
+     * @tparam T the vertices, K the keys
+     */
+    template<typename T, typename K = T, size_t D = 4>
+    class DaryHeap {
+    private:
+        std::vector<std::pair<T, K>> heap;
+
+    public:
+        using key_type = K;
+
+        [[nodiscard]] bool empty() const {
+            return this->heap.empty();
+        }
+
+        void clear() {
+            this->heap.clear();
+        }
+
+        void push(T vertex, K key) {
+            size_t i = this->heap.size();
+            this->heap.emplace_back(vertex, key);
+            while (i > 0) {
+                size_t parent = (i - 1) / D;
+                if (!(key < this->heap[parent].second)) {
+                    break;
+                }
+                this->heap[i] = this->heap[parent];
+                i = parent;
+            }
+            this->heap[i] = {vertex, key};
+        }
+
+        /**
+         * @brief Remove an entry with the smallest key
+         * @return std::pair(vertex, key)
+         */
+        std::pair<T, K> pop() {
+            std::pair<T, K> top = this->heap.front();
+            std::pair<T, K> last = this->heap.back();
+            this->heap.pop_back();
+
+            size_t i = 0;
+            size_t n = this->heap.size();
+            while (true) {
+                size_t first = i * D + 1;
+                if (first >= n) {
+                    break;
+                }
+                size_t best = first;
+                for (size_t c = first + 1; c < first + D && c < n; c++) {
+                    if (this->heap[c].second < this->heap[best].second) {
+                        best = c;
+                    }
+                }
+                if (!(this->heap[best].second < last.second)) {
+                    break;
+                }
+                this->heap[i] = this->heap[best];
+                i = best;
+            }
+            if (n > 0) {
+                this->heap[i] = last;
+            }
+            return top;
+        }
+    };
+
+    /**
+     * @brief Labels of a Dijkstra kept in two vectors, a vertex is reached once its distance is not -1
+     */
+    template<typename T, typename K = T>
+    struct DenseLabels {
+        std::vector<K> &distances;
+        std::vector<T> &parents;
+
+        [[nodiscard]] K distance(T v) const {
+            return this->distances[size_t(v)];
+        }
+
+        void reach(T v, K distance, T parent) {
+            this->distances[size_t(v)] = distance;
+            this->parents[size_t(v)] = parent;
+        }
+    };
+
+    /**
+     * @brief Dijkstra from a source, with lazy deletion of the outdated queue entries
+     * @param source -> the source
+     * @param labels -> no vertex reached yet, distance(v) (-1 if not reached) and reach(v, distance, parent), see DenseLabels
+     * @param queue -> an empty BucketQueue or DaryHeap, its keys are the distances
+     * @param forEachEdge -> forEachEdge(w, f) calls f(z, weight) for every edge w -> z
+     * @param target -> stop as soon as this vertex is settled, -1 to settle every reachable vertex
+     */
+    template<typename T, typename Labels, typename Queue, typename ForEachEdge>
+    void settle(T source, Labels &labels, Queue &queue, ForEachEdge forEachEdge, T target = -1) {
+        using K = typename Queue::key_type;
+
+        labels.reach(source, K(0), T(-1));
+        queue.push(source, K(0));
+        while (!queue.empty()) {
+            auto [w, d] = queue.pop();
+            if (d != labels.distance(w)) {
+                continue;
+            }
+            if (w == target) {
+                return;
+            }
+
+            forEachEdge(w, [&](T z, K weight) {
+                K candidate = d + weight;
+                K current = labels.distance(z);
+                if (current == K(-1) || candidate < current) {
+                    labels.reach(z, candidate, w);
+                    queue.push(z, candidate);
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Dijkstra from a source into two vectors
+     * @param distance -> filled with the distance from the source, -1 if not reachable
+     * @param parent -> filled with the parent in the shortest path tree, -1 for the source and the unreached vertices
+     * @param queue -> an empty BucketQueue or DaryHeap
+     * @see settle
+     */
+    template<typename T, typename K, typename Queue, typename ForEachEdge>
+    void dijkstra(T source, std::vector<K> &distance, std::vector<T> &parent, Queue &queue, ForEachEdge forEachEdge, T target = -1) {
+        std::fill(distance.begin(), distance.end(), K(-1));
+        std::fill(parent.begin(), parent.end(), T(-1));
+
+        DenseLabels<T, K> labels{distance, parent};
+        settle(source, labels, queue, forEachEdge, target);
+    }
+
+    /**
+     * @brief The best queue for the weights of a graph, kept between searches so they do not allocate once warm:
+     * a bucket queue, O(m + longest distance), for small integer weights, a 4-ary heap otherwise
+     * @tparam T the vertices, K the distances
+     */
+    template<typename T, typename K = T>
+    class Queues {
+    private:
+        std::optional<BucketQueue<T, K>> bucket;
+        DaryHeap<T, K> heap;
+
+    public:
+        /**
+         * @brief Call f(queue) with an empty queue
+         * @param minWeight -> the lightest edge of the graph (or 0), it must not be negative
+         * @param maxWeight -> the heaviest edge of the graph (or 0)
+         */
+        template<typename F>
+        void with(K minWeight, K maxWeight, F f) {
+            if (minWeight < 0) {
+                throw std::invalid_argument("Shortest paths need non negative weights");
+            }
+
+            if constexpr (std::is_integral_v<K>) {
+                if (size_t(maxWeight) <= maxBucketWeight) {
+                    if (!this->bucket.has_value() || this->bucket->maxWeight() != maxWeight) {
+                        this->bucket.emplace(maxWeight);
+                    }
+                    this->bucket->clear();
+                    f(*this->bucket);
+                    return;
+                }
+            }
+
+            this->heap.clear();
+            f(this->heap);
+        }
+    };
+
+    /**
+     * @brief Dijkstra with the best queue for the weights of the graph, see Queues
+     * @param minWeight -> the lightest edge of the graph (or 0), it must not be negative
+     * @param maxWeight -> the heaviest edge of the graph (or 0)
+     */
+    template<typename T, typename K, typename ForEachEdge>
+    void dijkstra(T source, std::vector<K> &distance, std::vector<T> &parent, K minWeight, K maxWeight, ForEachEdge forEachEdge, T target = -1) {
+        Queues<T, K> queues;
+        queues.with(minWeight, maxWeight, [&](auto &queue) {
+            dijkstra(source, distance, parent, queue, forEachEdge, target);
+        });
+    }
+}
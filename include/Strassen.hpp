@@ -0,0 +1,207 @@
+#pragma once
+
+#include "Gemm.hpp"
+#include "Constants.hpp"
+#include "ThreadPool.hpp"
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+namespace Strassen {
+    /**
+     * @brief Default size under which the blocked kernel is faster than one more level of recursion
+     */
+    constexpr size_t defaultCrossover = 512;
+
+    /**
+     * @brief Number of halvings until a block is not larger than crossover
+     */
+    inline size_t levels(size_t n, size_t crossover) {
+        size_t res = 0;
+        while ((n + (size_t(1) << res) - 1) >> res > std::max<size_t>(crossover, 1)) {
+            res++;
+        }
+        return res;
+    }
+
+    /**
+     * @brief Number of elements of scratch memory needed by a product of size n (a multiple of 2^levels)
+     * @param parallel -> the 7 products of the first level run at the same time, each with its own part
+     */
+    inline size_t workspace(size_t n, size_t levels, bool parallel) {
+        if (levels == 0) {
+            return 0;
+        }
+        size_t h = n / 2;
+        // S1..S4, T1..T4 and P1..P7, then the memory of the products below
+        return 15 * h * h + (parallel ? 7 : 1) * workspace(h, levels - 1, false);
+    }
+
+    /**
+     * @brief z = x + y, or x - y if subtract, on a row of count elements, z must not overlap x or y
+     * the chunks of 16 have a constant trip count so they are vectorized without a scalar epilogue
+     */
+    template<typename T>
+    GGRAPH_SIMD_CLONES
+    void combineRow(const T *__restrict x, const T *__restrict y, T *__restrict z, size_t count, bool subtract) {
+        size_t j = 0;
+        if (subtract) {
+            for (; j + 16 <= count; j += 16) {
+                for (size_t u = 0; u < 16; u++) {
+                    z[j + u] = x[j + u] - y[j + u];
+                }
+            }
+            for (; j < count; j++) {
+                z[j] = x[j] - y[j];
+            }
+        } else {
+            for (; j + 16 <= count; j += 16) {
+                for (size_t u = 0; u < 16; u++) {
+                    z[j + u] = x[j + u] + y[j + u];
+                }
+            }
+            for (; j < count; j++) {
+                z[j] = x[j] + y[j];
+            }
+        }
+    }
+
+    /**
+     * @brief z = x + y, or x - y if subtract, on h x h views
+     */
+    template<typename T>
+    void combine(const T *x, size_t ldx, const T *y, size_t ldy, T *z, size_t ldz, size_t h, bool subtract) {
+        for (size_t i = 0; i < h; i++) {
+            combineRow(x + i * ldx, y + i * ldy, z + i * ldz, h, subtract);
+        }
+    }
+
+    /**
+     * @brief C = A * B on n x n views with the Winograd form of Strassen (7 products, 15 additions)
+     * @param n -> a multiple of 2^levels
+     * @param scratch -> workspace(n, levels, pool != nullptr) elements, the temporaries of every level live there
+     * @param pool -> runs the 7 products of this level in parallel, the levels below run on the thread of their product
+     */
+    template<typename T>
+    void multiply(const T *a, size_t lda, const T *b, size_t ldb, T *c, size_t ldc, size_t n, size_t levels,
+                  T *scratch, ThreadPool *pool = nullptr) {
+        if (levels == 0) {
+            Gemm::multiply(a, lda, b, ldb, c, ldc, n, n, n);
+            return;
+        }
+
+        size_t h = n / 2;
+        const T *a11 = a, *a12 = a + h, *a21 = a + h * lda, *a22 = a + h * lda + h;
+        const T *b11 = b, *b12 = b + h, *b21 = b + h * ldb, *b22 = b + h * ldb + h;
+        T *c11 = c, *c12 = c + h, *c21 = c + h * ldc, *c22 = c + h * ldc + h;
+
+        T *s[4], *t[4], *p[7];
+        for (T *&block : s) {
+            block = scratch;
+            scratch += h * h;
+        }
+        for (T *&block : t) {
+            block = scratch;
+            scratch += h * h;
+        }
+        for (T *&block : p) {
+            block = scratch;
+            scratch += h * h;
+        }
+
+        combine(a21, lda, a22, lda, s[0], h, h, false);
+        combine(s[0], h, a11, lda, s[1], h, h, true);
+        combine(a11, lda, a21, lda, s[2], h, h, true);
+        combine(a12, lda, s[1], h, s[3], h, h, true);
+        combine(b12, ldb, b11, ldb, t[0], h, h, true);
+        combine(b22, ldb, t[0], h, t[1], h, h, true);
+        combine(b22, ldb, b12, ldb, t[2], h, h, true);
+        combine(t[1], h, b21, ldb, t[3], h, h, true);
+
+        // P1 = A11 B11, P2 = A12 B21, P3 = S4 B22, P4 = A22 T4, P5 = S1 T1, P6 = S2 T2, P7 = S3 T3
+        const T *x[7] = {a11, a12, s[3], a22, s[0], s[1], s[2]};
+        const size_t ldx[7] = {lda, lda, h, lda, h, h, h};
+        const T *y[7] = {b11, b21, b22, t[3], t[0], t[1], t[2]};
+        const size_t ldy[7] = {ldb, ldb, ldb, h, h, h, h};
+
+        if (pool == nullptr) {
+            for (size_t i = 0; i < 7; i++) {
+                multiply(x[i], ldx[i], y[i], ldy[i], p[i], h, h, levels - 1, scratch);
+            }
+        } else {
+            size_t part = workspace(h, levels - 1, false);
+            pool->parallelFor(7, [&](size_t /*id*/, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++) {
+                    multiply(x[i], ldx[i], y[i], ldy[i], p[i], h, h, levels - 1, scratch + i * part);
+                }
+            }, 1);
+        }
+
+        // C11 = P1 + P2, U2 = P1 + P6, U3 = U2 + P7, U4 = U2 + P5, C12 = U4 + P3, C21 = U3 - P4, C22 = U3 + P5
+        // U2, U3 and U4 reuse S1, S2 and S3, which are not needed anymore
+        T *u2 = s[0], *u3 = s[1], *u4 = s[2];
+        combine(p[0], h, p[1], h, c11, ldc, h, false);
+        combine(p[0], h, p[5], h, u2, h, h, false);
+        combine(u2, h, p[6], h, u3, h, h, false);
+        combine(u2, h, p[4], h, u4, h, h, false);
+        combine(u4, h, p[2], h, c12, ldc, h, false);
+        combine(u3, h, p[3], h, c21, ldc, h, true);
+        combine(u3, h, p[4], h, c22, ldc, h, false);
+    }
+
+    /**
+     * @brief Preallocated memory of the products, the padded copies of the operands and the temporaries of the recursion
+     * it keeps its buffers between products, so a loop of products of the same size allocates once
+     */
+    template<typename T>
+    class Arena {
+    private:
+        std::vector<T> padded;
+        std::vector<T> scratch;
+
+    public:
+        /**
+         * @brief Number of elements the buffers can hold without allocating
+         */
+        [[nodiscard]] size_t capacity() const {
+            return this->padded.capacity() + this->scratch.capacity();
+        }
+
+        /**
+         * @brief C = A * B for n x n row-major matrices, the operands are padded with zeros to a multiple of 2^levels
+         * @param crossover -> the blocks not larger than crossover are multiplied by the blocked kernel
+         * @param pool -> the threads running the 7 products of the first level, nullptr for the caller only
+         */
+        void multiply(const T *a, const T *b, T *c, size_t n, size_t crossover = defaultCrossover, ThreadPool *pool = nullptr) {
+            size_t depth = levels(n, crossover);
+            if (depth == 0) {
+                Gemm::multiply(a, b, c, n, n, n, pool);
+                return;
+            }
+
+            size_t block = size_t(1) << depth;
+            size_t m = (n + block - 1) / block * block;
+            bool parallel = pool != nullptr && pool->size() > 1;
+            this->scratch.resize(std::max(this->scratch.size(), workspace(m, depth, parallel)));
+
+            if (m == n) {
+                Strassen::multiply(a, n, b, n, c, n, n, depth, this->scratch.data(), parallel ? pool : nullptr);
+                return;
+            }
+
+            this->padded.assign(3 * m * m, T(0));
+            T *pa = this->padded.data(), *pb = pa + m * m, *pc = pb + m * m;
+            for (size_t i = 0; i < n; i++) {
+                std::copy(a + i * n, a + i * n + n, pa + i * m);
+                std::copy(b + i * n, b + i * n + n, pb + i * m);
+            }
+
+            Strassen::multiply<T>(pa, m, pb, m, pc, m, m, depth, this->scratch.data(), parallel ? pool : nullptr);
+
+            for (size_t i = 0; i < n; i++) {
+                std::copy(pc + i * m, pc + i * m + n, c + i * n);
+            }
+        }
+    };
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+
+/**
+ * @brief Fixed set of threads running the same job on every thread
+ * the calling thread takes part in every job as thread 0
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    const std::function<void(size_t)> *job = nullptr;
+    size_t generation = 0;
+    size_t running = 0;
+    bool stopping = false;
+
+    void work(size_t id) {
+        size_t seen = 0;
+        while (true) {
+            const std::function<void(size_t)> *current;
+            {
+                std::unique_lock<std::mutex> lock(this->mutex);
+                this->wake.wait(lock, [&] { return this->stopping || this->generation != seen; });
+                if (this->stopping) {
+                    return;
+                }
+                seen = this->generation;
+                current = this->job;
+            }
+
+            (*current)(id);
+
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (--this->running == 0) {
+                this->finished.notify_one();
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Start the pool
+     * @param threads -> the number of threads including the caller, 0 for one per hardware thread
+     */
+    explicit ThreadPool(size_t threads = 0) {
+        if (threads == 0) {
+            threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+        for (size_t id = 1; id < threads; id++) {
+            this->workers.emplace_back(&ThreadPool::work, this, id);
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->stopping = true;
+        }
+        this->wake.notify_all();
+        for (std::thread &worker : this->workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Number of threads running a job, the caller included
+     */
+    [[nodiscard]] size_t size() const {
+        return this->workers.size() + 1;
+    }
+
+    /**
+     * @brief Run job(threadId) on every thread and wait for all of them
+     * @param job -> the job, threadId is in [0, size())
+     */
+    void run(const std::function<void(size_t)> &job) {
+        if (this->workers.empty()) {
+            job(0);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->job = &job;
+            this->running = this->workers.size();
+            this->generation++;
+        }
+        this->wake.notify_all();
+
+        job(0);
+
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->finished.wait(lock, [&] { return this->running == 0; });
+    }
+
+    /**
+     * @brief Split [0, n) in chunks handed out to the threads on demand
+     * @param n -> the number of items
+     * @param body -> called as body(threadId, begin, end) for every chunk
+     * @param grain -> the size of a chunk
+     */
+    void parallelFor(size_t n, const std::function<void(size_t, size_t, size_t)> &body, size_t grain = 64) {
+        if (n <= grain || this->workers.empty()) {
+            body(0, 0, n);
+            return;
+        }
+
+        std::atomic<size_t> next = 0;
+        this->run([&](size_t id) {
+            for (size_t begin = next.fetch_add(grain); begin < n; begin = next.fetch_add(grain)) {
+                body(id, begin, std::min(n, begin + grain));
+            }
+        });
+    }
+};
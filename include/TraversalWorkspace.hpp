@@ -0,0 +1,150 @@
+#pragma once
+
+#include "Utils.hpp"
+#include "ShortestPath.hpp"
+
+#include <span>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+
+/**
+ * @brief Memory of the traversals (BFS, DFS, Dijkstra), lent to the graphs so a query does not allocate once the workspace is warm
+ * the marks of a vertex are valid only if its stamp is the epoch of the current run, reset() moves to the next epoch,
+ * so clearing the marks is O(1) and the arrays only grow to the largest graph seen
+ * a workspace serves one traversal at a time, give each thread its own
+ * @tparam T the vertices, D the distances
+ */
+template<typename T, typename D = T>
+class TraversalWorkspace {
+private:
+    /**
+     * @brief Marks of a vertex side by side, a relaxation reads one cache line
+     * stamp == _epoch: reached, on the stack of a DFS, _epoch + 1: finished, below _epoch: not reached in this run
+     */
+    struct Label {
+        uint32_t stamp = 0;
+        D distance = -1;
+        T parent = -1;
+    };
+
+    std::vector<Label> _labels;
+    std::vector<T> _order;
+    std::vector<T> _buffer;
+    std::vector<std::pair<T, size_t>> _stack;
+    ShortestPath::Queues<T, D> _queues;
+    uint32_t _epoch = 0;
+
+public:
+    TraversalWorkspace() = default;
+
+    /**
+     * @param vertices -> the arrays are allocated for that many vertices right away
+     */
+    explicit TraversalWorkspace(size_t vertices) {
+        this->reset(vertices);
+        this->_order.reserve(vertices);
+        this->_buffer.reserve(vertices);
+    }
+
+    /**
+     * @brief Start a new run on a graph of that many vertices, every vertex is unreached
+     */
+    void reset(size_t vertices) {
+        if (vertices > this->_labels.size()) {
+            this->_labels.resize(vertices);
+        }
+        if (this->_epoch >= std::numeric_limits<uint32_t>::max() - 2) {
+            // the stamps of the old runs could be mistaken for the next epochs
+            for (Label &label : this->_labels) {
+                label.stamp = 0;
+            }
+            this->_epoch = 0;
+        }
+        this->_epoch += 2;
+        this->_order.clear();
+        this->_stack.clear();
+    }
+
+    [[nodiscard]] bool reached(T v) const {
+        return this->_labels[size_t(v)].stamp >= this->_epoch;
+    }
+
+    /**
+     * @return the distance of v in this run, -1 if not reached
+     */
+    [[nodiscard]] D distance(T v) const {
+        return this->reached(v) ? this->_labels[size_t(v)].distance : D(-1);
+    }
+
+    /**
+     * @return the parent of v in this run, -1 for a root and the unreached vertices
+     */
+    [[nodiscard]] T parent(T v) const {
+        return this->reached(v) ? this->_labels[size_t(v)].parent : T(-1);
+    }
+
+    /**
+     * @brief Label v, the first time it is reached it is appended to order()
+     */
+    void reach(T v, D distance, T parent) {
+        Label &label = this->_labels[size_t(v)];
+        if (label.stamp < this->_epoch) {
+            label.stamp = this->_epoch;
+            this->_order.push_back(v);
+        }
+        label.distance = distance;
+        label.parent = parent;
+    }
+
+    /**
+     * @brief Color of v for a DFS, BLUE not reached, WHITE on the stack, RED finished
+     */
+    [[nodiscard]] Color color(T v) const {
+        uint32_t stamp = this->_labels[size_t(v)].stamp;
+        return stamp < this->_epoch ? Color::BLUE : stamp == this->_epoch ? Color::WHITE : Color::RED;
+    }
+
+    void paint(T v, Color color) {
+        this->_labels[size_t(v)].stamp = color == Color::BLUE ? 0 : color == Color::WHITE ? this->_epoch : this->_epoch + 1;
+    }
+
+    /**
+     * @return the vertices reached by reach() in this run, in the order they were reached
+     */
+    [[nodiscard]] std::span<const T> order() const {
+        return this->_order;
+    }
+
+    /**
+     * @return the vertices from the root of v to v, by the parents of this run, v must be reached
+     */
+    std::span<const T> pathTo(T v) {
+        this->_buffer.clear();
+        for (T w = v; w != T(-1); w = this->_labels[size_t(w)].parent) {
+            this->_buffer.push_back(w);
+        }
+        std::reverse(this->_buffer.begin(), this->_buffer.end());
+        return this->_buffer;
+    }
+
+    /**
+     * @brief Memory for the result of a query (a DFS order, a path), valid until the next query
+     */
+    std::vector<T> &buffer() {
+        return this->_buffer;
+    }
+
+    /**
+     * @brief Empty stack of a DFS
+     */
+    std::vector<std::pair<T, size_t>> &stack() {
+        return this->_stack;
+    }
+
+    ShortestPath::Queues<T, D> &queues() {
+        return this->_queues;
+    }
+};
@@ -8,6 +8,9 @@
 #include <algorithm>
 #include <string>
 #include <chrono>
+#include <compare>
+#include <ostream>
+#include <type_traits>
 
 namespace Utils {
     bool isNumber(const std::string& s);
@@ -27,6 +30,84 @@ namespace Type {
         PREORDER,
         POSTORDER
     };
+
+    enum Direction {
+        TOP_DOWN,
+        BOTTOM_UP
+    };
+
+    // where the adjacency lists live: the global heap, or an arena owned by the graph and released with it
+    enum Storage {
+        HEAP,
+        ARENA
+    };
+
+    /**
+     * @brief Weight of the edges of an unweighted graph (W = void), it takes no room in an arc and every edge counts as 1
+     * any number converts to it, so addEdge(from, to) and the factories keep working, and it converts back to 1
+     */
+    struct Unweighted {
+        constexpr Unweighted() = default;
+
+        template<typename N>
+        requires std::is_arithmetic_v<N>
+        constexpr Unweighted(N) {}
+
+        template<typename N>
+        requires std::is_arithmetic_v<N>
+        constexpr explicit operator N() const {
+            return N(1);
+        }
+
+        friend constexpr auto operator<=>(Unweighted, Unweighted) = default;
+
+        friend std::ostream &operator<<(std::ostream &os, Unweighted) {
+            return os << 1;
+        }
+
+        friend std::string to_string(Unweighted) {
+            return "1";
+        }
+    };
+
+    /**
+     * @brief The weights stored by a graph for its W parameter
+     */
+    template<typename W>
+    using WeightOf = std::conditional_t<std::is_void_v<W>, Unweighted, W>;
+
+    /**
+     * @brief Default distance of a graph: a sum of weights, or a signed number of edges when the graph is unweighted
+     */
+    template<typename T, typename W>
+    struct Distance {
+        using type = W;
+    };
+
+    template<typename T>
+    struct Distance<T, void> {
+        using type = std::make_signed_t<T>;
+    };
+
+    template<typename T, typename W>
+    using DistanceOf = typename Distance<T, W>::type;
+
+    /**
+     * @brief Arc of an unweighted adjacency list, only the neighbour is stored, first and second mirror std::pair
+     */
+    template<typename T>
+    struct UnweightedArc {
+        T first;
+        [[no_unique_address]] Unweighted second;
+
+        friend constexpr bool operator==(const UnweightedArc &, const UnweightedArc &) = default;
+    };
+
+    /**
+     * @brief Arc of an adjacency list, std::pair(neighbour, weight), or the neighbour alone when W is void
+     */
+    template<typename T, typename W>
+    using ArcOf = std::conditional_t<std::is_void_v<W>, UnweightedArc<T>, std::pair<T, W>>;
 };
 
 enum Color {
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <bit>
+#include <span>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+
+/**
+ * @brief Group varint: the values go by groups of four, a control byte holds the number of bytes - 1 of each value
+ * (2 bits, the first value in the low bits) and is followed by the values in 1 to 4 little endian bytes,
+ * this is the byte-aligned layout of StreamVByte with each control byte next to its data, so a value is decoded
+ * with a 4 bytes load and a mask instead of a branch per byte
+ */
+namespace Varint {
+    /**
+     * @brief Bytes read past the last value by the 4 bytes loads, the buffer must have that many bytes after its end
+     */
+    constexpr size_t padding = 3;
+
+    inline unsigned bytesOf(uint32_t value) {
+        return value < (1u << 8) ? 1 : value < (1u << 16) ? 2 : value < (1u << 24) ? 3 : 4;
+    }
+
+    /**
+     * @brief Bytes of the data of a group, the control byte excluded
+     */
+    inline size_t groupBytes(unsigned control) {
+        return 4 + (control & 3) + ((control >> 2) & 3) + ((control >> 4) & 3) + (control >> 6);
+    }
+
+    /**
+     * @brief The value of that many bytes at p
+     */
+    inline uint32_t load(const uint8_t *p, unsigned bytes) {
+        uint32_t value;
+        std::memcpy(&value, p, 4);
+        if constexpr (std::endian::native == std::endian::big) {
+            value = std::byteswap(value);
+        }
+        return value & uint32_t(~uint64_t(0) >> (64 - 8 * bytes));
+    }
+
+    /**
+     * @brief Append the values, the last group may hold fewer than four, its missing values are coded on one byte without data
+     */
+    inline void encode(std::span<const uint32_t> values, std::vector<uint8_t> &out) {
+        for (size_t i = 0; i < values.size(); i += 4) {
+            size_t control = out.size();
+            out.push_back(0);
+            for (size_t k = 0; k < 4 && i + k < values.size(); k++) {
+                unsigned bytes = bytesOf(values[i + k]);
+                out[control] |= uint8_t((bytes - 1) << (2 * k));
+                for (unsigned b = 0; b < bytes; b++) {
+                    out.push_back(uint8_t(values[i + k] >> (8 * b)));
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Number of values in the group at p of a list that ends at end, four except for the last group
+     */
+    inline size_t groupCount(const uint8_t *p, const uint8_t *end) {
+        size_t bytes = groupBytes(*p);
+        size_t left = size_t(end - p - 1);
+        return bytes <= left ? 4 : 4 - (bytes - left);
+    }
+
+    /**
+     * @brief Decode the groups of [p, end), f(value) is called on every value in order
+     */
+    template<typename F>
+    void decode(const uint8_t *p, const uint8_t *end, F f) {
+        while (p != end) {
+            unsigned control = *p;
+            size_t count = groupCount(p, end);
+            p++;
+            if (count == 4) {
+                // the full groups have no loop, so the four loads are issued together
+                unsigned b0 = (control & 3) + 1, b1 = ((control >> 2) & 3) + 1, b2 = ((control >> 4) & 3) + 1, b3 = (control >> 6) + 1;
+                uint32_t v0 = load(p, b0), v1 = load(p + b0, b1), v2 = load(p + b0 + b1, b2), v3 = load(p + b0 + b1 + b2, b3);
+                p += b0 + b1 + b2 + b3;
+                f(v0);
+                f(v1);
+                f(v2);
+                f(v3);
+            } else {
+                for (size_t k = 0; k < count; k++) {
+                    unsigned bytes = ((control >> (2 * k)) & 3) + 1;
+                    f(load(p, bytes));
+                    p += bytes;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Signed to unsigned with the small magnitudes first, 0, -1, 1, -2... become 0, 1, 2, 3...
+     */
+    inline uint32_t zigzag(int32_t value) {
+        return (uint32_t(value) << 1) ^ uint32_t(value >> 31);
+    }
+
+    inline int32_t unzigzag(uint32_t value) {
+        return int32_t(value >> 1) ^ -int32_t(value & 1);
+    }
+}
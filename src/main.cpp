@@ -30,9 +30,9 @@ int main(int argv, char **argc) {
     std::string graphType = argc[1];
 
     if (graphType == "list") {
-        runGraphArgs<List::Graph<int>>(args);
+        dispatchGraphArgs<List::Graph>(args);
     } else if (graphType == "matrix") {
-        runGraphArgs<Matrix::Graph<int>>(args);
+        dispatchGraphArgs<Matrix::Graph>(args);
     } else {
         if (argv == 1) {
             Logger::error("Please provide a graph type as first argument, see --help for more informations");
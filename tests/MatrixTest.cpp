@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+
 struct SimpleMatrix : public ::testing::Test {
     Matrix::M<int> m;
     SimpleMatrix() : m(s(2, 2)) {
@@ -228,6 +230,245 @@ TEST(Matrix, mulNotSameSize) {
     ASSERT_EQ(m3, res);
 }
 
+template<typename T>
+Matrix::M<T> randomMatrix(size_t row, size_t col, std::mt19937 &gen) {
+    std::uniform_int_distribution<int> dist(-9, 9);
+    Matrix::M<T> m(row, col);
+    for (size_t i = 0; i < row; i++) {
+        for (size_t j = 0; j < col; j++) {
+            m.set(i, j, T(dist(gen)));
+        }
+    }
+    return m;
+}
+
+template<typename T>
+void checkBlockedProduct(size_t rows, size_t inner, size_t cols) {
+    std::mt19937 gen(rows * inner + cols);
+    Matrix::M<T> a = randomMatrix<T>(rows, inner, gen);
+    Matrix::M<T> b = randomMatrix<T>(inner, cols, gen);
+
+    Matrix::M<T> expected(rows, cols);
+    for (size_t i = 0; i < rows; i++) {
+        for (size_t j = 0; j < cols; j++) {
+            T sum = 0;
+            for (size_t k = 0; k < inner; k++) {
+                sum += a(i, k) * b(k, j);
+            }
+            expected.set(i, j, sum);
+        }
+    }
+
+    // small integers are exact in every type, so the blocked order gives the same result
+    Matrix::M<T> res = a * b;
+    ASSERT_EQ(res, expected);
+}
+
+TEST(Matrix, mulBlockedEdges) {
+    // sizes around the register tile and the KC, MC and NC panels
+    checkBlockedProduct<int>(1, 1, 1);
+    checkBlockedProduct<int>(5, 3, 33);
+    checkBlockedProduct<int>(131, 300, 37);
+    checkBlockedProduct<double>(130, 257, 1030);
+    checkBlockedProduct<float>(67, 513, 17);
+}
+
+TEST(Matrix, mulParallelSameResult) {
+    std::mt19937 gen(3);
+    // 3 x 2 tiles of C, more tiles than threads and some threads without a tile
+    Matrix::M<int> a = randomMatrix<int>(300, 270, gen);
+    Matrix::M<int> b = randomMatrix<int>(270, 1100, gen);
+    Matrix::M<int> res = a * b;
+    for (size_t threads : {2, 4, 8}) {
+        Matrix::M<int> parallel = a.multiply(b, threads);
+        ASSERT_EQ(parallel, res);
+    }
+
+    Matrix::M<double> c = randomMatrix<double>(200, 300, gen);
+    Matrix::M<double> d = randomMatrix<double>(300, 150, gen);
+    Matrix::M<double> parallel = c.multiply(d, 3);
+    ASSERT_EQ(parallel, c * d);
+}
+
+TEST(Matrix, powerParallel) {
+    std::mt19937 gen(5);
+    std::uniform_int_distribution<int> dist(0, 1);
+    Matrix::M<int> m(150, 150);
+    for (size_t i = 0; i < 150; i++) {
+        for (size_t j = 0; j < 150; j++) {
+            m.set(i, j, dist(gen));
+        }
+    }
+
+    Matrix::M<int> res = Matrix::M<int>::power(m, 3);
+    Matrix::M<int> parallel = Matrix::M<int>::power(m, 3, 4);
+    ASSERT_EQ(parallel, res);
+    ASSERT_EQ(res, m * m * m);
+}
+
+TEST(Matrix, mulSemirings) {
+    const int inf = Semiring::infinity<int>();
+    Matrix::M<int> w(s(3, 3));
+    int data[] = {
+            0, 4, inf,
+            inf, 0, 1,
+            2, inf, 0
+    };
+    w = data;
+
+    Matrix::M<int> minPlus(s(3, 3));
+    int shortest[] = {
+            0, 4, 5,
+            3, 0, 1,
+            2, 6, 0
+    };
+    minPlus = shortest;
+    ASSERT_EQ(w.multiply<Semiring::MinPlus<int>>(w), minPlus);
+    ASSERT_EQ(Matrix::M<int>::power<Semiring::MinPlus<int>>(w, 3), minPlus);
+
+    // the longest walks of exactly two edges, 0 -> 1 -> 2 beats the direct edge 0 -> 2
+    const int none = Semiring::MaxPlus<int>::zero();
+    Matrix::M<int> dag(s(3, 3));
+    int arcs[] = {
+            none, 4, 1,
+            none, none, 1,
+            none, none, none
+    };
+    dag = arcs;
+
+    Matrix::M<int> maxPlus(s(3, 3));
+    maxPlus.fill(none);
+    maxPlus(0, 2, 5);
+    ASSERT_EQ(dag.multiply<Semiring::MaxPlus<int>>(dag), maxPlus);
+}
+
+TEST_F(SimpleMatrix, mulBooleanAndModulo) {
+    Matrix::M<int> res(s(2, 2));
+    res.fill(1);
+    ASSERT_EQ(m.multiply<Semiring::Boolean<int>>(m), res);
+
+    // 4 ^ 20 = 2 ^ 40 overflows an int, the counts modulo 1000 do not
+    Matrix::M<int> ones(s(2, 2));
+    ones.fill(2);
+    Matrix::M<int> counts = Matrix::M<int>::power<Semiring::ModCount<int, 1000>>(ones, 21);
+    Matrix::M<int> expected(s(2, 2));
+    expected.fill(int((uint64_t(1) << 41) % 1000));
+    ASSERT_EQ(counts, expected);
+
+    using Mod = Semiring::ModCount<int, 1000>;
+    ASSERT_EQ(Matrix::M<int>::power<Mod>(ones, 0), Matrix::M<int>::identityMatrix(2));
+}
+
+TEST(Matrix, mulStrassen) {
+    std::mt19937 gen(9);
+    // no recursion, padding from 37 to 40 with 3 levels, 128 without padding
+    for (auto [n, crossover] : std::vector<std::pair<size_t, size_t>>({{1, 8}, {37, 5}, {128, 16}})) {
+        Matrix::M<int> a = randomMatrix<int>(n, n, gen);
+        Matrix::M<int> b = randomMatrix<int>(n, n, gen);
+        Matrix::M<int> res = a * b;
+
+        Matrix::M<int> strassen = a.strassen(b, crossover);
+        ASSERT_EQ(strassen, res);
+        Matrix::M<int> parallel = a.strassen(b, crossover, 3);
+        ASSERT_EQ(parallel, res);
+    }
+
+    std::uniform_real_distribution<double> dist(-1, 1);
+    Matrix::M<double> a(100, 100);
+    Matrix::M<double> b(100, 100);
+    for (size_t i = 0; i < 100; i++) {
+        for (size_t j = 0; j < 100; j++) {
+            a.set(i, j, dist(gen));
+            b.set(i, j, dist(gen));
+        }
+    }
+    Matrix::M<double> res = a * b;
+    Matrix::M<double> strassen = a.strassen(b, 10);
+    for (size_t i = 0; i < 100; i++) {
+        for (size_t j = 0; j < 100; j++) {
+            ASSERT_NEAR(strassen(i, j), res(i, j), 1e-10);
+        }
+    }
+
+    Matrix::M<int> rectangle(s(2, 3));
+    ASSERT_THROW(rectangle.strassen(rectangle), std::invalid_argument);
+}
+
+TEST(Matrix, mulStrassenArena) {
+    std::mt19937 gen(11);
+    // 37 is padded to 40, so the arena holds the padded operands as well as the scratch space
+    Matrix::M<int> a = randomMatrix<int>(37, 37, gen);
+    Matrix::M<int> b = randomMatrix<int>(37, 37, gen);
+    Strassen::Arena<int> arena;
+
+    // the threaded products need a scratch space per product of the first level, the most an arena of that size holds
+    ASSERT_EQ(a.strassen(b, arena, 5, 3), a * b);
+    size_t capacity = arena.capacity();
+    ASSERT_GT(capacity, 0);
+
+    Matrix::M<int> c = randomMatrix<int>(37, 37, gen);
+    ASSERT_EQ(c.strassen(a, arena, 5), c * a);
+    ASSERT_EQ(a.strassen(c, arena, 5, 3), a * c);
+    ASSERT_EQ(arena.capacity(), capacity);
+}
+
+TEST(Matrix, mulIncompatibleSizes) {
+    Matrix::M<int> a(s(2, 3));
+    Matrix::M<int> b(s(2, 3));
+
+    ASSERT_THROW(a * b, std::invalid_argument);
+}
+
+// ----------------- TESTING EXPRESSIONS --------------
+
+TEST(Matrix, expressionFused) {
+    std::mt19937 gen(7);
+    // 37 x 29 cells, not a multiple of the chunks of the evaluation
+    Matrix::M<int> a = randomMatrix<int>(37, 29, gen);
+    Matrix::M<int> b = randomMatrix<int>(37, 29, gen);
+    Matrix::M<int> c = randomMatrix<int>(37, 29, gen);
+
+    Matrix::M<int> res = a + b - c * 3 + 2 * a / 2;
+    for (size_t i = 0; i < 37; i++) {
+        for (size_t j = 0; j < 29; j++) {
+            ASSERT_EQ(res(i, j), a(i, j) + b(i, j) - c(i, j) * 3 + 2 * a(i, j) / 2);
+        }
+    }
+
+    // the products are eager, a node on either side is evaluated first
+    Matrix::M<int> square = randomMatrix<int>(29, 29, gen);
+    ASSERT_EQ((a + b) * square, Matrix::M<int>(a + b) * square);
+    ASSERT_EQ(square * (square - square), Matrix::M<int>(29, 29));
+}
+
+TEST(Matrix, expressionAliasing) {
+    std::mt19937 gen(11);
+    Matrix::M<int> a = randomMatrix<int>(40, 40, gen);
+    Matrix::M<int> b = randomMatrix<int>(40, 40, gen);
+    Matrix::M<int> expected = a * 2 + b;
+
+    a = a * 2 + b;
+    ASSERT_EQ(a, expected);
+
+    a += b - b * 2;
+    a -= expected - b;
+    ASSERT_EQ(a, Matrix::M<int>(40, 40));
+
+    // assigning to a matrix of another size resizes it
+    Matrix::M<int> empty;
+    empty = b + b;
+    ASSERT_EQ(empty.size().row, 40);
+    ASSERT_EQ(empty, b * 2);
+}
+
+TEST(Matrix, expressionIncompatibleSizes) {
+    Matrix::M<int> a(s(2, 3));
+    Matrix::M<int> b(s(3, 2));
+
+    ASSERT_THROW(a + b, std::invalid_argument);
+    ASSERT_THROW(a - b * 2, std::invalid_argument);
+}
+
 // ----------------- TESTING POWER --------------
 
 TEST_F(SimpleMatrix, power) {
@@ -300,4 +541,51 @@ TEST_F(SimpleMatrix, copy_equal) {
     secondMatrix = m;
 
     ASSERT_EQ(m, secondMatrix);
-}
\ No newline at end of file
+}
+
+TEST_F(SimpleMatrix, copyResizes) {
+    Matrix::M<int> secondMatrix;
+
+    secondMatrix = m;
+
+    ASSERT_EQ(secondMatrix.size().row, 2);
+    ASSERT_EQ(m, secondMatrix);
+}
+
+TEST(Matrix, fromPointer) {
+    const int cells[6] = {1, 2, 3, 4, 5, 6};
+    Matrix::M<int> m(cells, 2, 3);
+
+    ASSERT_EQ(m.size().row, 2);
+    ASSERT_EQ(m.size().col, 3);
+    ASSERT_EQ(m(1, 0), 4);
+
+    const std::pair<int, int> arcs[4] = {{0, 0}, {1, 5}, {1, 2}, {0, 0}};
+    Matrix::adjacentMatrix<int> adjacent(arcs, 2);
+    ASSERT_EQ(adjacent.size(), 2);
+    ASSERT_EQ(adjacent.at(0, 1), std::make_pair(1, 5));
+    ASSERT_EQ(Matrix::M<int>(adjacent)(1, 0), 1);
+}
+
+TEST_F(SimpleMatrix, move) {
+    Matrix::M<int> copy(m);
+    const int *cells = m.data();
+
+    Matrix::M<int> moved(std::move(m));
+    ASSERT_EQ(moved.data(), cells);
+    ASSERT_EQ(moved, copy);
+    ASSERT_EQ(m.size().row, 0);
+
+    Matrix::M<int> assigned(s(3, 3));
+    assigned = std::move(moved);
+    ASSERT_EQ(assigned.data(), cells);
+    ASSERT_EQ(assigned, copy);
+}
+
+TEST(Matrix, alignedStorage) {
+    Matrix::M<double> m(s(7, 5));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(m.data()) % Aligned::alignment, 0);
+
+    Matrix::M<double> product = m * Matrix::M<double>(s(5, 3));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(product.data()) % Aligned::alignment, 0);
+}
@@ -0,0 +1,100 @@
+#include "../include/BoolMatrix.hpp"
+#include "../include/MatrixGraph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+Matrix::Graph<int> randomDirectedGraph(int n, double p, unsigned seed) {
+    Matrix::Graph<int> g(n, Type::Graph::DIRECTED);
+    std::mt19937 gen(seed);
+    std::bernoulli_distribution edge(p);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if (edge(gen)) {
+                g.addEdge(i, j);
+            }
+        }
+    }
+    return g;
+}
+
+void expectSamePattern(const Matrix::BoolMatrix &b, const Matrix::M<int> &m) {
+    for (size_t i = 0; i < b.size(); i++) {
+        for (size_t j = 0; j < b.size(); j++) {
+            ASSERT_EQ(b.test(i, j), m(i, j) != 0) << i << " " << j;
+        }
+    }
+}
+
+TEST(BoolMatrix, setAndTest) {
+    Matrix::BoolMatrix m(130);
+    m.set(0, 129);
+    m.set(64, 63);
+    m.set(64, 63, false);
+    m.set(129, 0);
+
+    ASSERT_EQ(m.words(), 3);
+    ASSERT_TRUE(m.test(0, 129));
+    ASSERT_FALSE(m.test(64, 63));
+    ASSERT_EQ(m.count(), 2);
+    ASSERT_THROW(m.test(130, 0), std::out_of_range);
+}
+
+TEST(BoolMatrix, productSparseAndDense) {
+    // a sparse left matrix takes one row OR per bit, a dense one the Four Russians tables
+    for (double p : {0.01, 0.5}) {
+        for (int n : {1, 7, 65, 200}) {
+            auto g = randomDirectedGraph(n, p, n);
+            Matrix::BoolMatrix b = g.toBoolMatrix();
+            Matrix::M<int> m = g.toMatrix();
+
+            expectSamePattern(b * b, m * m);
+        }
+    }
+}
+
+TEST(BoolMatrix, powerAndAccumulate) {
+    auto g = randomDirectedGraph(90, 0.02, 11);
+    Matrix::M<int> m = g.toMatrix();
+    Matrix::M<int> sum = m;
+    Matrix::M<int> last = m;
+
+    for (int k = 1; k <= 9; k++) {
+        expectSamePattern(g.reachability(k), last);
+        expectSamePattern(Matrix::BoolMatrix::accumulate(g.toBoolMatrix(), k), sum);
+        last = last * m;
+        sum += last;
+    }
+
+    ASSERT_EQ(Matrix::BoolMatrix::power(g.toBoolMatrix(), 0), Matrix::BoolMatrix::identity(90));
+}
+
+TEST(BoolMatrix, transitiveClosure) {
+    auto g = randomDirectedGraph(150, 0.008, 5);
+    Matrix::BoolMatrix closure = g.transitiveClosure();
+
+    for (int v = 0; v < 150; v++) {
+        // the vertices reached by a walk of at least one edge
+        std::vector<bool> reached(150, false);
+        std::vector<int> stack;
+        for (auto [z, weight] : g[v]) {
+            stack.push_back(z);
+        }
+        while (!stack.empty()) {
+            int w = stack.back();
+            stack.pop_back();
+            if (reached[w]) {
+                continue;
+            }
+            reached[w] = true;
+            for (auto [z, weight] : g[w]) {
+                stack.push_back(z);
+            }
+        }
+
+        for (int w = 0; w < 150; w++) {
+            ASSERT_EQ(closure.test(v, w), reached[w]) << v << " " << w;
+        }
+    }
+}
@@ -0,0 +1,171 @@
+#include "../include/CompressedGraph.hpp"
+
+#include <gtest/gtest.h>
+
+struct SimpleGraphCompressed : public ::testing::Test {
+    List::Graph<int> list;
+    Compressed::Graph<int> g;
+    SimpleGraphCompressed() : list(4) {
+        list.addEdge(0, 1);
+        list.addEdge(1, 2);
+        list.addEdge(2, 3);
+        g = Compressed::Graph<int>(list);
+    }
+};
+
+struct ComplexGraphCompressed : public ::testing::Test {
+    List::Graph<int> list;
+    Compressed::Graph<int> g;
+    ComplexGraphCompressed() : list(18) {
+        list.addEdge(0, 1);
+        list.addEdge(0, 2);
+        list.addEdge(0, 4);
+        list.addEdge(0, 9);
+        list.addEdge(4, 3);
+        list.addEdge(4, 5);
+        list.addEdge(4, 6);
+        list.addEdge(6, 7);
+        list.addEdge(9, 8);
+        list.addEdge(9, 10);
+        list.addEdge(10, 11);
+        list.addEdge(11, 12);
+        list.addEdge(13, 0);
+        list.addEdge(14, 13);
+        list.addEdge(15, 0);
+        list.addEdge(16, 15);
+        list.addEdge(17, 16);
+        g = Compressed::Graph<int>(list);
+    }
+};
+
+// ----------------- TESTING LAYOUT --------------
+
+TEST_F(SimpleGraphCompressed, GraphLayout) {
+    ASSERT_EQ(g.size(), 4);
+    ASSERT_EQ(g.arcs(), 6);
+    ASSERT_EQ(g.encodedBytes(), 10);
+    ASSERT_EQ(g.degres(1), 2);
+    ASSERT_EQ(g.neighbours(1), std::vector<int>({0, 2}));
+}
+
+TEST(GraphCompressed, GraphSortedGaps) {
+    // lists out of order, first neighbours below the vertex and gaps of several bytes
+    List::Graph<uint32_t, void> list(300000, Type::Graph::DIRECTED);
+    list.addEdge(5, 299999);
+    list.addEdge(5, 3);
+    list.addEdge(5, 130);
+    list.addEdge(5, 3);
+    list.addEdge(200000, 0);
+    list.addEdge(200000, 199999);
+
+    Compressed::Graph<uint32_t> g(list);
+    ASSERT_EQ(g.neighbours(5), std::vector<uint32_t>({3, 3, 130, 299999}));
+    ASSERT_EQ(g.neighbours(200000), std::vector<uint32_t>({0, 199999}));
+    ASSERT_EQ(g.degres(5), 4);
+    ASSERT_EQ(g.degres(6), 0);
+    auto dfs = g.DFS(200000);
+    ASSERT_EQ(std::vector<uint32_t>(dfs.begin(), dfs.begin() + 3), std::vector<uint32_t>({200000, 0, 199999}));
+    ASSERT_EQ(g.path(5, 299999).value().first, 1);
+}
+
+TEST(GraphCompressed, GraphBytesPerArc) {
+    auto list = List::Graph<int>::createCycleGraph(1000);
+    Compressed::Graph<int> g(list);
+
+    ASSERT_EQ(g.arcs(), 2000);
+    ASSERT_LE(g.encodedBytes(), 2 * g.arcs());
+}
+
+// ----------------- TESTING TRAVERSALS --------------
+
+TEST_F(SimpleGraphCompressed, GraphBFS) {
+    ASSERT_EQ(g.BFS(), std::vector<int>({0, 1, 2, 3}));
+}
+
+TEST_F(SimpleGraphCompressed, GraphDFS) {
+    ASSERT_EQ(g.DFS(), std::vector<int>({0, 1, 2, 3}));
+    ASSERT_EQ(g.DFS(0, Type::Print::POSTORDER), std::vector<int>({3, 2, 1, 0}));
+}
+
+TEST(GraphCompressed, GraphSameAsList) {
+    // the factories add the arcs of a vertex in increasing order, so the lists are already sorted
+    for (Type::Graph directed : {Type::Graph::UNDIRECTED, Type::Graph::DIRECTED}) {
+        auto list = List::Graph<int>::createRandomGraph(350, directed, .05);
+        Compressed::Graph<int> g(list);
+
+        ASSERT_EQ(g.BFS(), list.BFS());
+        ASSERT_EQ(g.DFS(), list.DFS());
+        ASSERT_EQ(g.DFS(7, Type::Print::POSTORDER), list.DFS(7, Type::Print::POSTORDER));
+        ASSERT_EQ(g.distanceFrom(5), list.distanceFrom(5));
+        ASSERT_EQ(g.cycle().has_value(), list.cycle().has_value());
+    }
+}
+
+TEST_F(ComplexGraphCompressed, GraphDFSTree) {
+    auto tree = g.DFSTree();
+
+    ASSERT_EQ(tree.preorder, g.DFS());
+    ASSERT_EQ(tree.postorder, g.DFS(0, Type::Print::POSTORDER));
+    ASSERT_EQ(tree.postorder.back(), 0);
+}
+
+// ----------------- TESTING PATH / CYCLE --------------
+
+TEST_F(SimpleGraphCompressed, GraphPath) {
+    auto res = g.path(0, 3);
+
+    ASSERT_TRUE(res.has_value());
+    ASSERT_EQ(res.value().first, 3);
+    ASSERT_EQ(res.value().second, std::vector<int>({0, 1, 2, 3}));
+}
+
+TEST_F(ComplexGraphCompressed, GraphNoPath) {
+    list.removeEdge(10, 11);
+    g = Compressed::Graph<int>(list);
+
+    ASSERT_FALSE(g.path(17, 12).has_value());
+}
+
+TEST_F(ComplexGraphCompressed, GraphNoCycle) {
+    ASSERT_FALSE(g.cycle().has_value());
+}
+
+TEST(GraphCompressed, GraphCycle) {
+    List::Graph<int> list(6);
+
+    list.addEdge(0, 1);
+    list.addEdge(0, 2);
+    list.addEdge(1, 2);
+    list.addEdge(1, 4);
+    list.addEdge(4, 5);
+    list.addEdge(2, 3);
+
+    ASSERT_TRUE(Compressed::Graph<int>(list).cycle().has_value());
+}
+
+// ----------------- TESTING ECCENTRICITY / RADIUS / DIAMETER --------------
+
+TEST_F(ComplexGraphCompressed, GraphEccentricity) {
+    auto res = g.eccentricity(0);
+
+    ASSERT_TRUE(res.has_value());
+    ASSERT_EQ(res.value().first, 4);
+    ASSERT_EQ(res.value().second, 12);
+}
+
+TEST_F(ComplexGraphCompressed, GraphDiameter) {
+    auto res = g.diameter();
+
+    ASSERT_TRUE(res.has_value());
+    ASSERT_EQ(res.value().first, 7);
+    ASSERT_EQ(res.value().second.first, 7);
+    ASSERT_EQ(res.value().second.second, 12);
+}
+
+TEST(GraphCompressed, GraphDiameterRandomGraph) {
+    auto graph = List::Graph<int>::createRandomGraph(150, Type::UNDIRECTED, 0.03);
+    Compressed::Graph<int> g(graph);
+
+    ASSERT_EQ(g.radius(), graph.radius());
+    ASSERT_EQ(g.diameter(), graph.diameter());
+}
@@ -0,0 +1,206 @@
+#include "../include/CsrGraph.hpp"
+
+#include <gtest/gtest.h>
+
+// the snapshots of the graphs main builds, every member is compiled even when no test calls it
+template class Csr::Graph<uint32_t, void>;
+template class Csr::Graph<uint32_t, int32_t>;
+template class Csr::Graph<uint64_t, void>;
+template class Csr::Graph<uint64_t, int64_t>;
+
+struct SimpleGraphCsr : public ::testing::Test {
+    List::Graph<int> list;
+    Csr::Graph<int> g;
+    SimpleGraphCsr() : list(4) {
+        list.addEdge(0, 1);
+        list.addEdge(1, 2);
+        list.addEdge(2, 3);
+        g = Csr::Graph<int>(list);
+    }
+};
+
+struct ComplexGraphCsr : public ::testing::Test {
+    List::Graph<int> list;
+    Csr::Graph<int> g;
+    ComplexGraphCsr() : list(18) {
+        list.addEdge(0, 1);
+        list.addEdge(0, 2);
+        list.addEdge(0, 4);
+        list.addEdge(0, 9);
+        list.addEdge(4, 3);
+        list.addEdge(4, 5);
+        list.addEdge(4, 6);
+        list.addEdge(6, 7);
+        list.addEdge(9, 8);
+        list.addEdge(9, 10);
+        list.addEdge(10, 11);
+        list.addEdge(11, 12);
+        list.addEdge(13, 0);
+        list.addEdge(14, 13);
+        list.addEdge(15, 0);
+        list.addEdge(16, 15);
+        list.addEdge(17, 16);
+        g = Csr::Graph<int>(list);
+    }
+};
+
+struct RandomGraphCsr : public ::testing::Test {
+    List::Graph<int> list;
+    Csr::Graph<int> g;
+    RandomGraphCsr() : list(List::Graph<int>::createRandomGraph(350, Type::UNDIRECTED, .2, true)), g(list) {}
+};
+
+// ----------------- TESTING LAYOUT --------------
+
+TEST_F(SimpleGraphCsr, GraphLayout) {
+    ASSERT_EQ(g.size(), 4);
+    ASSERT_EQ(g.arcs(), 6);
+    ASSERT_EQ(g.degres(1), 2);
+    ASSERT_EQ(std::vector<int>(g.neighbours(1).begin(), g.neighbours(1).end()), std::vector<int>({0, 2}));
+}
+
+TEST_F(RandomGraphCsr, GraphSameNeighbours) {
+    for (int v = 0; v < g.size(); v++) {
+        auto neighbours = g.neighbours(v);
+        auto weights = g.weightsOf(v);
+        auto expected = list[v];
+
+        ASSERT_EQ(neighbours.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_EQ(neighbours[i], expected[i].first);
+            ASSERT_EQ(weights[i], expected[i].second);
+        }
+    }
+}
+
+// ----------------- TESTING TRAVERSALS --------------
+
+TEST_F(SimpleGraphCsr, GraphBFS) {
+    ASSERT_EQ(g.BFS(), std::vector<int>({0, 1, 2, 3}));
+}
+
+TEST_F(SimpleGraphCsr, GraphDFS) {
+    ASSERT_EQ(g.DFS(), std::vector<int>({0, 1, 2, 3}));
+    ASSERT_EQ(g.DFS(0, Type::Print::POSTORDER), std::vector<int>({3, 2, 1, 0}));
+}
+
+TEST_F(RandomGraphCsr, GraphSameAsList) {
+    ASSERT_EQ(g.BFS(), list.BFS());
+    ASSERT_EQ(g.DFS(), list.DFS());
+    ASSERT_EQ(g.distanceFrom(5), list.distanceFrom(5));
+    ASSERT_EQ(g.isBipartite(), list.isBipartite());
+}
+
+// ----------------- TESTING PATH --------------
+
+TEST_F(SimpleGraphCsr, GraphPath) {
+    auto res = g.path(0, 3);
+
+    ASSERT_TRUE(res.has_value());
+    ASSERT_EQ(res.value().first, 3);
+    ASSERT_EQ(res.value().second, std::vector<int>({0, 1, 2, 3}));
+}
+
+TEST_F(ComplexGraphCsr, GraphNoPath) {
+    list.removeEdge(10, 11);
+    g = Csr::Graph<int>(list);
+
+    ASSERT_FALSE(g.path(17, 12).has_value());
+}
+
+TEST_F(SimpleGraphCsr, GraphDistanceFromSource) {
+    ASSERT_EQ(g.distanceFromSource(), std::vector<int>({0, 1, 2, 3}));
+}
+
+// ----------------- TESTING CYCLE / BIPARTITE --------------
+
+TEST_F(ComplexGraphCsr, GraphNoCycle) {
+    ASSERT_FALSE(g.cycle().has_value());
+}
+
+TEST(GraphCsr, GraphCycle) {
+    List::Graph<int> list(6);
+
+    list.addEdge(0, 1);
+    list.addEdge(0, 2);
+    list.addEdge(1, 2);
+    list.addEdge(1, 4);
+    list.addEdge(4, 5);
+    list.addEdge(2, 3);
+
+    ASSERT_TRUE(Csr::Graph<int>(list).cycle().has_value());
+}
+
+TEST_F(SimpleGraphCsr, GraphIsBipartite) {
+    ASSERT_TRUE(g.isBipartite());
+}
+
+// ----------------- TESTING ECCENTRICITY / RADIUS / DIAMETER --------------
+
+TEST_F(ComplexGraphCsr, GraphEccentricity) {
+    auto res = g.eccentricity(0);
+
+    ASSERT_TRUE(res.has_value());
+    ASSERT_EQ(res.value().first, 4);
+    ASSERT_EQ(res.value().second, 12);
+}
+
+TEST_F(ComplexGraphCsr, GraphRadius) {
+    auto res = g.radius();
+
+    ASSERT_TRUE(res.has_value());
+    ASSERT_EQ(res.value().first, 4);
+    ASSERT_EQ(res.value().second.first, 0);
+    ASSERT_EQ(res.value().second.second, 12);
+}
+
+TEST_F(ComplexGraphCsr, GraphDiameter) {
+    auto res = g.diameter();
+
+    ASSERT_TRUE(res.has_value());
+    ASSERT_EQ(res.value().first, 7);
+    ASSERT_EQ(res.value().second.first, 7);
+    ASSERT_EQ(res.value().second.second, 12);
+}
+
+TEST(GraphCsr, GraphDiameterRandomGraph) {
+    auto graph = List::Graph<int>::createRandomGraph(150, Type::UNDIRECTED, 0.03, true);
+    Csr::Graph<int> g(graph);
+
+    ASSERT_EQ(g.radius(), graph.radius());
+    ASSERT_EQ(g.diameter(), graph.diameter());
+}
+
+TEST(GraphCsr, GraphSameAsListWideTypes) {
+    auto weighted = List::Graph<uint32_t, int32_t>::createRandomGraph(200, Type::UNDIRECTED, 0.03, true);
+    Csr::Graph<uint32_t, int32_t> g(weighted);
+
+    for (uint32_t v = 0; v < 200; v++) {
+        std::vector<int32_t> weights;
+        for (const auto &[z, weight] : weighted[v]) {
+            weights.push_back(weight);
+        }
+        ASSERT_EQ(std::vector<int32_t>(g.weightsOf(v).begin(), g.weightsOf(v).end()), weights);
+    }
+    ASSERT_EQ(g.distanceFrom(3), weighted.distanceFrom(3));
+    ASSERT_EQ(g.path(0, 150), weighted.path(0, 150));
+    ASSERT_EQ(g.diameter(), weighted.diameter());
+
+    // no weight array, the distances count the edges in a signed type
+    auto unweighted = List::Graph<uint64_t, void>::createRandomGraph(200, Type::UNDIRECTED, 0.03);
+    Csr::Graph<uint64_t, void> h(unweighted);
+    std::vector<int64_t> distance = h.distanceFrom(3);
+
+    ASSERT_EQ(distance, unweighted.distanceFrom(3));
+    ASSERT_EQ(h.BFS(), unweighted.BFS());
+    ASSERT_EQ(h.radius(), unweighted.radius());
+    ASSERT_EQ(h.eccentricity(0), unweighted.eccentricity(0));
+}
+
+TEST_F(ComplexGraphCsr, GraphDFSTree) {
+    auto tree = g.DFSTree();
+
+    ASSERT_EQ(tree.preorder, g.DFS());
+    ASSERT_EQ(tree.postorder, g.DFS(0, Type::Print::POSTORDER));
+    ASSERT_EQ(tree.postorder.back(), 0);
+}
@@ -1,7 +1,17 @@
 #include "../include/MatrixGraph.hpp"
+#include "../include/ListGraph.hpp"
 
 #include <gtest/gtest.h>
 
+#include <map>
+#include <random>
+
+// the id and weight types main dispatches to, instantiated whole so the members the tests never reach still compile
+template class Matrix::Graph<uint32_t, void>;
+template class Matrix::Graph<uint32_t, int32_t>;
+template class Matrix::Graph<uint64_t, void>;
+template class Matrix::Graph<uint64_t, int64_t>;
+
 struct SimpleGraphMatrix : public ::testing::Test {
     Matrix::Graph<double> g;
     SimpleGraphMatrix() : g(4) {
@@ -72,6 +82,184 @@ TEST_F(ComplexGraphMatrix, GraphBFS_Length) {
     ASSERT_EQ(res.size(), g.size());
 }
 
+TEST_F(RandomGraphMatrix, GraphParallelBFS_allEdge) {
+
+    auto res = g.parallelBFS(0, 4);
+
+    ASSERT_EQ(res.size(), g.size());
+    ASSERT_EQ(res.front(), 0);
+}
+
+TEST_F(ComplexGraphMatrix, GraphParallelBFS_Tree) {
+
+    auto tree = g.parallelBFSTree(0, 4);
+
+    ASSERT_EQ(tree.first[12], 4);
+    ASSERT_EQ(tree.first[17], 3);
+    ASSERT_EQ(tree.second[12], 11);
+    ASSERT_EQ(tree.second[0], -1);
+}
+
+TEST_F(ComplexGraphMatrix, GraphBFS_Order) {
+
+    std::vector<double> res = {0, 1, 2, 4, 9, 13, 15, 3, 5, 6, 8, 10, 14, 16, 7, 11, 17, 12};
+
+    ASSERT_EQ(g.BFS(), res);
+}
+
+TEST_F(ComplexGraphMatrix, GraphNeighbours) {
+
+    std::vector<std::pair<double, double>> res = {{0, 1}, {3, 1}, {5, 1}, {6, 1}};
+
+    auto neighbours = g[4];
+    std::vector<std::pair<double, double>> copy(neighbours.begin(), neighbours.end());
+    ASSERT_EQ(copy, res);
+    ASSERT_TRUE(g[17].begin() != g[17].end());
+    ASSERT_EQ(std::ranges::distance(g[0]), 6);
+    ASSERT_EQ(g.degres(0), 6);
+}
+
+TEST(GraphMatrix, GraphNeighboursEmpty) {
+    Matrix::Graph<int> g(3);
+    g.addEdge(0, 2, 5);
+
+    ASSERT_TRUE(g[1].empty());
+    ASSERT_TRUE(*g[2].begin() == std::make_pair(0, 5));
+}
+
+TEST(GraphMatrix, GraphBitStorage) {
+    Matrix::Graph<int> g(130, Type::DIRECTED);
+    g.addEdge(0, 63);
+    g.addEdge(0, 64, 5);
+    g.addEdge(0, 129, 7);
+    g.addEdge(129, 0);
+
+    std::vector<std::pair<int, int>> res = {{63, 1}, {64, 5}, {129, 7}};
+    auto neighbours = g[0];
+    std::vector<std::pair<int, int>> copy(neighbours.begin(), neighbours.end());
+
+    ASSERT_EQ(copy, res);
+    ASSERT_EQ(g.degres(0), 3);
+    ASSERT_EQ(g.at(0, 64), std::make_pair(1, 5));
+    ASSERT_EQ(g(0, 65), std::make_pair(0, 0));
+    ASSERT_EQ(g.DFS(0), g.BFS(0));
+
+    g.removeEdge(0, 64);
+    ASSERT_EQ(g.degres(0), 2);
+    ASSERT_FALSE(g.test(0, 64));
+}
+
+TEST(GraphMatrix, GraphBitStorageDenseWeights) {
+    auto g = Matrix::Graph<int>::createCompleteGraph(40, Type::UNDIRECTED, true);
+
+    for (int v = 0; v < 40; v++) {
+        ASSERT_EQ(g.degres(v), 39);
+        for (auto [w, weight] : g[v]) {
+            ASSERT_EQ(weight, g.at(w, v).second);
+            ASSERT_GE(weight, 1);
+        }
+    }
+}
+
+TEST(GraphMatrix, GraphBitStorageRowWeights) {
+    // weights set, overwritten and removed in any order stay in the order of the bits of their row
+    Matrix::Graph<int> g(100, Type::DIRECTED);
+    std::map<std::pair<int, int>, int> expected;
+
+    std::mt19937 gen(3);
+    std::uniform_int_distribution<int> vertex(0, 99);
+    std::uniform_int_distribution<int> weight(1, 3);
+    for (int i = 0; i < 5000; i++) {
+        int from = vertex(gen) % 4;
+        int to = vertex(gen);
+        if (i % 4 == 0) {
+            g.removeEdge(from, to);
+            expected.erase({from, to});
+        } else {
+            int w = weight(gen);
+            g.addEdge(from, to, w);
+            expected[{from, to}] = w;
+        }
+    }
+
+    for (int v = 0; v < 4; v++) {
+        std::vector<std::pair<int, int>> res;
+        for (const auto &[arc, w] : expected) {
+            if (arc.first == v) {
+                res.emplace_back(arc.second, w);
+            }
+        }
+        auto neighbours = g[v];
+        std::vector<std::pair<int, int>> copy(neighbours.begin(), neighbours.end());
+        ASSERT_EQ(copy, res);
+        for (const auto &[w, weight] : res) {
+            ASSERT_EQ(g.at(v, w), std::make_pair(1, weight));
+        }
+    }
+}
+
+TEST_F(SimpleGraphMatrix, GraphMatrixPath) {
+    auto paths = g.matrixPath(2);
+
+    ASSERT_EQ(paths(0, 2), 1);
+    ASSERT_EQ(paths(1, 1), 2);
+    ASSERT_EQ(paths(0, 3), 0);
+}
+
+TEST(GraphMatrix, GraphMatrixPathCounts) {
+    // unsigned ids, the counts are the signed distances unless the caller picks another type or semiring
+    auto g = Matrix::Graph<uint32_t, void>::createCompleteGraph(6, Type::Graph::UNDIRECTED);
+
+    Matrix::M<int32_t> paths = g.matrixPath(3);
+    ASSERT_EQ(paths(0, 1), 21);
+    ASSERT_EQ(paths(0, 0), 20);
+
+    auto wide = g.matrixPath<int64_t>(20);
+    // closed walks of K6: (5^20 + 5) / 6, past an int32
+    ASSERT_EQ(wide(0, 0), 15894571940105LL);
+
+    auto modulo = g.matrixPath<int64_t, Semiring::ModCount<int64_t>>(20);
+    ASSERT_EQ(modulo(0, 0), wide(0, 0) % 1000000007);
+
+    auto all = g.matrixAllPath<int64_t, Semiring::ModCount<int64_t>>();
+    ASSERT_EQ(all(0, 1), 1 + 4 + 21 + 104 + 521);
+}
+
+TEST(GraphMatrix, GraphMatrixAllPath) {
+    // 0 -> 1 -> 2 -> 3, every pair i < j has exactly one walk
+    Matrix::Graph<int> line(4, Type::Graph::DIRECTED);
+    line.addEdge(0, 1);
+    line.addEdge(1, 2);
+    line.addEdge(2, 3);
+
+    auto paths = line.matrixAllPath();
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t j = 0; j < 4; j++) {
+            ASSERT_EQ(paths(i, j), i < j ? 1 : 0) << i << " " << j;
+        }
+    }
+}
+
+TEST(GraphMatrix, GraphMatrixAllPathUntilStable) {
+    auto g = Matrix::Graph<int>::createRandomGraph(12, Type::Graph::DIRECTED, 0.15);
+
+    Matrix::M<int> adjacency = g.toMatrix();
+    Matrix::M<int> expected = adjacency;
+    for (int i = 2; i < 12; i++) {
+        expected += adjacency ^ i;
+    }
+
+    auto full = g.matrixAllPath(false, 2);
+    auto stable = g.matrixAllPath(true);
+    ASSERT_EQ(full, expected);
+    for (size_t i = 0; i < 12; i++) {
+        for (size_t j = 0; j < 12; j++) {
+            ASSERT_EQ(stable(i, j) == 0, full(i, j) == 0);
+            ASSERT_LE(stable(i, j), full(i, j));
+        }
+    }
+}
+
 // ----------------- TESTING DFS --------------
 
 TEST_F(SimpleGraphMatrix, GraphDFS) {
@@ -88,6 +276,51 @@ TEST_F(SimpleGraphMatrix, GraphDFS_Stack) {
     ASSERT_EQ(g.BFS(), res);
 }
 
+TEST_F(ComplexGraphMatrix, GraphDFS_Order) {
+    ASSERT_EQ(g.DFS(), std::vector<double>({0, 1, 2, 4, 3, 5, 6, 7, 9, 8, 10, 11, 12, 13, 14, 15, 16, 17}));
+    ASSERT_EQ(g.DFS(0, Type::Print::POSTORDER), std::vector<double>({1, 2, 3, 5, 7, 6, 4, 8, 12, 11, 10, 9, 14, 13, 17, 16, 15, 0}));
+    ASSERT_EQ(g.DFSTree().parent[12], 11);
+}
+
+TEST(GraphMatrix, GraphBitsetTraversalAcrossWords) {
+    // 130 vertices span three words, the edges are added in increasing order so the list keeps sorted neighbours
+    const int n = 130;
+    Matrix::Graph<int> m(n);
+    List::Graph<int> l(n);
+    std::mt19937 gen(7);
+    std::bernoulli_distribution edge(0.03);
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+            if (edge(gen) || j == i + 64) {
+                m.addEdge(i, j);
+                l.addEdge(i, j);
+            }
+        }
+    }
+
+    ASSERT_EQ(m.BFS(), l.BFS());
+    ASSERT_EQ(m.BFS(100), l.BFS(100));
+    ASSERT_EQ(m.DFS(), l.DFS());
+    ASSERT_EQ(m.DFS(129, Type::Print::POSTORDER), l.DFS(129, Type::Print::POSTORDER));
+    ASSERT_EQ(m.DFSTree(63).parent, l.DFSTree(63).parent);
+}
+
+TEST(GraphMatrix, GraphBitsetTraversalComplete) {
+    auto g = Matrix::Graph<int>::createCompleteGraph(200);
+
+    auto bfs = g.BFS(5);
+    ASSERT_EQ(bfs.size(), 200);
+    ASSERT_EQ(bfs[0], 5);
+    ASSERT_EQ(bfs[1], 0);
+    ASSERT_EQ(bfs[199], 199);
+
+    // every vertex is a neighbour of the previous one, so the DFS is a single path in increasing order
+    auto tree = g.DFSTree(0);
+    for (int v = 1; v < 200; v++) {
+        ASSERT_EQ(tree.parent[v], v - 1);
+    }
+}
+
 TEST_F(RandomGraphMatrix, GraphDFS_allEdge) {
 
     auto res = g.BFS();
@@ -103,6 +336,73 @@ TEST_F(RandomGraphMatrix, GraphDFS_Stack_allEdge) {
 }
 
 
+TEST(GraphMatrix, GraphAllPairsDistances) {
+    auto g = Matrix::Graph<int>::createRandomGraph(120, Type::Graph::DIRECTED, 0.03, true);
+    auto distance = g.allPairsDistances(2);
+
+    for (int v = 0; v < 120; v++) {
+        auto expected = g.distanceFrom(v);
+        for (int w = 0; w < 120; w++) {
+            ASSERT_EQ(distance(v, w), expected[w]) << v << " " << w;
+        }
+    }
+}
+
+TEST(GraphMatrix, GraphAllPairsDistancesNegative) {
+    Matrix::Graph<int> g(3, Type::Graph::DIRECTED);
+    g.addEdge(0, 1, 4);
+    g.addEdge(1, 2, -3);
+    g.addEdge(0, 2, 2);
+
+    auto distance = g.allPairsDistances();
+    ASSERT_EQ(distance(0, 2), 1);
+    ASSERT_EQ(distance(2, 0), -1);
+    ASSERT_EQ(distance(1, 1), 0);
+}
+
+TEST(GraphMatrix, GraphFloydWarshall) {
+    // 150 vertices, so 3 x 3 tiles with a partial last one
+    auto g = Matrix::Graph<int>::createRandomGraph(150, Type::Graph::DIRECTED, 0.02, true);
+    auto [distance, next] = g.floydWarshall(true, 3);
+    auto [withoutNext, none] = g.floydWarshall();
+
+    ASSERT_FALSE(none.has_value());
+    ASSERT_EQ(distance, withoutNext);
+    for (int v = 0; v < 150; v++) {
+        auto expected = g.distanceFrom(v);
+        for (int w = 0; w < 150; w++) {
+            ASSERT_EQ(distance(v, w), expected[w]) << v << " " << w;
+
+            auto path = Matrix::Graph<int>::nextHopPath(next.value(), v, w);
+            if (expected[w] == -1) {
+                ASSERT_TRUE(path.empty());
+                continue;
+            }
+            int lenght = 0;
+            for (size_t i = 1; i < path.size(); i++) {
+                ASSERT_TRUE(g.test(path[i - 1], path[i]));
+                lenght += g.at(path[i - 1], path[i]).second;
+            }
+            ASSERT_EQ(lenght, expected[w]);
+        }
+    }
+}
+
+TEST(GraphMatrix, GraphFloydWarshallNegative) {
+    Matrix::Graph<int> g(3, Type::Graph::DIRECTED);
+    g.addEdge(0, 1, 4);
+    g.addEdge(1, 2, -3);
+    g.addEdge(0, 2, 2);
+
+    auto [distance, next] = g.floydWarshall(true, 1);
+    ASSERT_EQ(distance(0, 2), 1);
+    ASSERT_EQ(Matrix::Graph<int>::nextHopPath(next.value(), 0, 2), std::vector<int>({0, 1, 2}));
+
+    // 0 -> 1 -> 2 -> 0 weighs -1
+    g.addEdge(2, 0, -2);
+    ASSERT_THROW(g.floydWarshall(), std::invalid_argument);
+}
+
 // ----------------- TESTING PATH --------------
 
 TEST_F(RandomGraphMatrix, GraphPath) {
@@ -135,6 +435,14 @@ TEST_F(ComplexGraphMatrix, GraphNotPath) {
     ASSERT_FALSE(res.has_value());
 }
 
+TEST_F(ComplexGraphMatrix, GraphPathDFS) {
+    auto res = g.path(17, 12);
+
+    ASSERT_TRUE(res.has_value());
+    ASSERT_EQ(res.value().first, 7);
+    ASSERT_EQ(res.value().second, std::vector<double>({17, 16, 15, 0, 9, 10, 11, 12}));
+}
+
 TEST_F(SimpleGraphMatrixDirected, GraphLongestPath) {
 
     auto res = g.longestPath();
@@ -181,6 +489,20 @@ TEST(GraphMatrix, GraphCycle) {
     ASSERT_TRUE(cycle.has_value());
 }
 
+TEST(GraphMatrix, GraphCycleDirected) {
+    Matrix::Graph<int> g(4, Type::DIRECTED);
+    g.addEdge(0, 1);
+    g.addEdge(0, 2);
+    g.addEdge(1, 2);
+
+    ASSERT_FALSE(g.cycle().has_value());
+
+    g.addEdge(2, 3);
+    g.addEdge(3, 1);
+
+    ASSERT_EQ(g.cycle(), std::vector<int>({1, 2, 3, 1}));
+}
+
 
 // ----------------- TESTING BIPARTITE --------------
 
@@ -289,4 +611,76 @@ TEST_F(ComplexGraphMatrix, GraphDiameter) {
     ASSERT_EQ(res.value().first, 7);
     ASSERT_EQ(res.value().second.first, 7);
     ASSERT_EQ(res.value().second.second, 12);
-}
\ No newline at end of file
+}
+
+TEST(Graph, GraphMatrixMove) {
+    Matrix::Graph<int> g = Matrix::Graph<int>::createCycleGraph(6);
+    Matrix::Graph<int> copy(g);
+
+    Matrix::Graph<int> moved(std::move(g));
+    ASSERT_EQ(moved.size(), 6);
+    ASSERT_EQ(moved.BFS(0), copy.BFS(0));
+    ASSERT_EQ(g.size(), 0);
+
+    g = std::move(moved);
+    ASSERT_EQ(g.BFS(0).size(), 6);
+    ASSERT_EQ(moved.size(), 0);
+}
+
+TEST(Graph, GraphMatrixWorkspace) {
+    TraversalWorkspace<int> workspace;
+    for (Type::Graph directed : {Type::Graph::UNDIRECTED, Type::Graph::DIRECTED}) {
+        for (int n : {70, 130, 15}) {
+            auto g = Matrix::Graph<int>::createRandomGraph(n, directed, 0.04, true);
+
+            auto bfs = g.BFS(2, workspace);
+            ASSERT_EQ(std::vector<int>(bfs.begin(), bfs.end()), g.BFS(2));
+            auto dfs = g.DFS(0, Type::Print::PREORDER, workspace);
+            ASSERT_EQ(std::vector<int>(dfs.begin(), dfs.end()), g.DFS(0, Type::Print::PREORDER));
+            ASSERT_EQ(g.isBipartite(workspace), g.isBipartite());
+
+            for (int v = 0; v < n; v += 5) {
+                std::vector<int> distance = g.distanceFrom(v);
+                g.distanceFrom(v, workspace);
+                for (int w = 0; w < n; w++) {
+                    ASSERT_EQ(workspace.distance(w), distance[w]);
+                }
+                ASSERT_EQ(g.eccentricity(v, workspace), g.eccentricity(v));
+
+                auto expected = g.path(v, n - 1 - v);
+                auto res = g.path(v, n - 1 - v, workspace);
+                ASSERT_EQ(res.has_value(), expected.has_value());
+                if (res.has_value()) {
+                    ASSERT_EQ(res.value().first, expected.value().first);
+                    ASSERT_EQ(std::vector<int>(res.value().second.begin(), res.value().second.end()), expected.value().second);
+                }
+            }
+        }
+    }
+}
+
+TEST(Graph, GraphMatrixSeparateWeights) {
+    Matrix::Graph<uint32_t, double> g(4, Type::Graph::DIRECTED);
+    g.addEdge(0, 1, 0.5);
+    g.addEdge(1, 2, 0.25);
+    g.addEdge(0, 2, 1.0);
+    g.addEdge(2, 3, 1.5);
+
+    ASSERT_EQ(g.distanceFrom(0), std::vector<double>({0, 0.5, 0.75, 2.25}));
+    auto [distance, next] = g.floydWarshall(true);
+    ASSERT_DOUBLE_EQ(distance(0, 3), 2.25);
+    ASSERT_EQ((Matrix::Graph<uint32_t, double>::nextHopPath(next.value(), 0, 3)), std::vector<uint32_t>({0, 1, 2, 3}));
+
+    auto weighted = Matrix::Graph<int>::createRandomGraph(90, Type::Graph::DIRECTED, 0.05);
+    Matrix::Graph<uint32_t, void> unweighted(90, Type::Graph::DIRECTED);
+    for (int v = 0; v < 90; v++) {
+        for (auto [w, weight] : weighted[v]) {
+            unweighted.addEdge(v, w);
+        }
+    }
+    for (int v = 0; v < 90; v += 13) {
+        auto res = unweighted.distanceFrom(v);
+        ASSERT_EQ(std::vector<int>(res.begin(), res.end()), weighted.distanceFrom(v));
+    }
+    ASSERT_EQ(unweighted.allPairsDistances(), weighted.allPairsDistances());
+}
@@ -0,0 +1,164 @@
+#include "../include/ShortestPath.hpp"
+#include "../include/ListGraph.hpp"
+#include "../include/MatrixGraph.hpp"
+#include "../include/CsrGraph.hpp"
+
+#include <gtest/gtest.h>
+
+struct WeightedGraphList : public ::testing::Test {
+    List::Graph<int> g;
+    WeightedGraphList() : g(5) {
+        g.addEdge(0, 1, 10);
+        g.addEdge(0, 2, 1);
+        g.addEdge(2, 1, 1);
+        g.addEdge(1, 3, 5);
+        g.addEdge(2, 3, 20);
+    }
+};
+
+// ----------------- TESTING QUEUES --------------
+
+TEST(ShortestPath, BucketQueueOrder) {
+    ShortestPath::BucketQueue<int> q(10);
+
+    q.push(0, 0);
+    q.push(1, 7);
+    q.push(2, 3);
+    q.push(3, 10);
+
+    ASSERT_EQ(q.pop(), std::make_pair(0, 0));
+    q.push(4, 5);
+    ASSERT_EQ(q.pop(), std::make_pair(2, 3));
+    ASSERT_EQ(q.pop(), std::make_pair(4, 5));
+    ASSERT_EQ(q.pop(), std::make_pair(1, 7));
+    ASSERT_EQ(q.pop(), std::make_pair(3, 10));
+    ASSERT_TRUE(q.empty());
+}
+
+TEST(ShortestPath, DaryHeapOrder) {
+    ShortestPath::DaryHeap<double> q;
+    std::vector<double> keys = {5.5, 1.25, 9, 0.5, 3, 7, 2, 8, 4, 6};
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        q.push(double(i), keys[i]);
+    }
+
+    std::ranges::sort(keys);
+    for (double key : keys) {
+        ASSERT_EQ(q.pop().second, key);
+    }
+    ASSERT_TRUE(q.empty());
+}
+
+// ----------------- TESTING DIJKSTRA --------------
+
+TEST_F(WeightedGraphList, GraphShortestDistance) {
+    ASSERT_EQ(g.distanceFrom(0), std::vector<int>({0, 2, 1, 7, -1}));
+}
+
+TEST_F(WeightedGraphList, GraphShortestPath) {
+    auto res = g.path(0, 3);
+
+    ASSERT_TRUE(res.has_value());
+    ASSERT_EQ(res.value().first, 7);
+    ASSERT_EQ(res.value().second, std::vector<int>({0, 2, 1, 3}));
+}
+
+TEST_F(WeightedGraphList, GraphWeightedEccentricity) {
+    auto res = g.eccentricity(3);
+
+    ASSERT_TRUE(res.has_value());
+    ASSERT_EQ(res.value().first, 7);
+    ASSERT_EQ(res.value().second, 0);
+}
+
+TEST_F(WeightedGraphList, CsrShortestDistance) {
+    ASSERT_EQ(Csr::Graph<int>(g).distanceFrom(0), g.distanceFrom(0));
+    ASSERT_EQ(Csr::Graph<int>(g).path(0, 3), g.path(0, 3));
+}
+
+TEST(ShortestPath, MatrixShortestDistance) {
+    Matrix::Graph<double> g(4);
+
+    g.addEdge(0, 1, 2.5);
+    g.addEdge(0, 2, 0.5);
+    g.addEdge(2, 1, 0.75);
+
+    ASSERT_EQ(g.distanceFrom(0), std::vector<double>({0, 1.25, 0.5, -1}));
+}
+
+TEST(ShortestPath, BucketAndHeapAgree) {
+    auto g = List::Graph<int>::createRandomGraph(300, Type::UNDIRECTED, .05, true);
+    std::vector<int> bucketDistance(g.size()), heapDistance(g.size()), parent(g.size());
+    auto forEachEdge = [&g](int w, auto &&relax) {
+        for (auto z : g[w]) {
+            relax(z.first, z.second);
+        }
+    };
+
+    ShortestPath::BucketQueue<int> bucket(100);
+    ShortestPath::dijkstra(0, bucketDistance, parent, bucket, forEachEdge);
+    ShortestPath::DaryHeap<int> heap;
+    ShortestPath::dijkstra(0, heapDistance, parent, heap, forEachEdge);
+
+    ASSERT_EQ(bucketDistance, heapDistance);
+    ASSERT_EQ(bucketDistance, g.distanceFrom(0));
+}
+
+TEST(ShortestPath, QueuesReusedAfterEarlyStop) {
+    auto g = List::Graph<int>::createRandomGraph(200, Type::UNDIRECTED, .05, true);
+    auto forEachEdge = [&g](int w, auto &&relax) {
+        for (auto z : g[w]) {
+            relax(z.first, z.second);
+        }
+    };
+
+    // a search stopped on its target leaves entries in the queue, the next search must not see them
+    TraversalWorkspace<int> workspace;
+    for (int target : {5, 120, -1}) {
+        workspace.reset(g.size());
+        workspace.queues().with(0, 100, [&](auto &queue) {
+            ShortestPath::settle(3, workspace, queue, forEachEdge, target);
+        });
+    }
+
+    std::vector<int> distance = g.distanceFrom(3);
+    for (int v = 0; v < g.size(); v++) {
+        ASSERT_EQ(workspace.distance(v), distance[v]);
+    }
+}
+
+TEST(ShortestPath, NegativeWeight) {
+    List::Graph<int> g(2);
+
+    g.addEdge(0, 1, -1);
+
+    ASSERT_THROW(g.distanceFrom(0), std::invalid_argument);
+}
+
+// ----------------- TESTING DELTA-STEPPING --------------
+
+TEST_F(WeightedGraphList, GraphDeltaStepping) {
+    ASSERT_EQ(g.deltaSteppingDistanceFrom(0, 2), g.distanceFrom(0));
+    ASSERT_EQ(g.deltaSteppingDistanceFrom(0, 2, 3), g.distanceFrom(0));
+}
+
+TEST(ShortestPath, DeltaSteppingRandomGraph) {
+    auto g = List::Graph<int>::createRandomGraph(500, Type::UNDIRECTED, .02, true);
+
+    for (int delta : {0, 1, 7, 100}) {
+        ASSERT_EQ(g.deltaSteppingDistanceFrom(3, 4, delta), g.distanceFrom(3));
+    }
+}
+
+TEST(ShortestPath, AutoDelta) {
+    ASSERT_EQ(ShortestPath::autoDelta<int>(10000, 1000000, 100), 1);
+    ASSERT_EQ(ShortestPath::autoDelta<int>(1000, 10000, 100), 10);
+    ASSERT_EQ(ShortestPath::autoDelta<int>(10, 0, 100), 1);
+    // vertices * maxWeight and the arcs do not fit in an int
+    ASSERT_EQ(ShortestPath::autoDelta<int>(50000000, 400000000, 100), 12);
+    ASSERT_EQ(ShortestPath::autoDelta<int>(1000000000, 8000000000, 100), 12);
+    // a forest has fewer arcs than vertices, the width stays at the heaviest edge
+    ASSERT_EQ(ShortestPath::autoDelta<int>(1000, 10, 100), 100);
+    ASSERT_DOUBLE_EQ(ShortestPath::autoDelta<double>(1000, 10, 2.5), 2.5);
+}